@@ -7,22 +7,6 @@
 #include "vm.h"
 #include "memory.h"
 
-static void init_constant(Chunk *chunk) {
-    add_constant(chunk, int_value(0));
-    add_constant(chunk, int_value(1));
-    add_constant(chunk, int_value(2));
-    add_constant(chunk, int_value(3));
-    add_constant(chunk, int_value(4));
-    add_constant(chunk, int_value(5));
-    add_constant(chunk, int_value(6));
-    add_constant(chunk, int_value(7));
-    add_constant(chunk, int_value(8));
-    add_constant(chunk, float_value(1.0));
-    add_constant(chunk, float_value(2.0));
-    add_constant(chunk, float_value(0.5));
-    add_constant(chunk, float_value(0.0));
-}
-
 /**
  * @param i0 [7,0]
  * @param i1 [15,8]
@@ -37,8 +21,9 @@ void init_chunk(Chunk *c) {
     c->count = 0;
     c->code = NULL;
     c->lines = NULL;
+    c->exception_count = 0;
+    c->exceptions = NULL;
     init_ValueArray(&c->constants);
-    init_constant(c);
 }
 
 int compute_new_capacity(Chunk *c) {
@@ -67,32 +52,10 @@ void free_chunk(Chunk *c) {
     FREE_ARRAY(uint8_t, c->code, c->count);
     FREE_ARRAY(int, c->lines, c->count);
     free_ValueArray(&c->constants);
+    FREE_ARRAY(ExceptionRange, c->exceptions, c->exception_count);
 //    init_chunk(c);
 }
 
-/**
- * 少部分常数会被预先加载到constants。
- * @param value
- * @return 如果value被预先加载，返回其索引，否则返回-1
- */
-int constant_mapping(Value value) {
-    if (is_int(value) && as_int(value) <= 8) {
-        return as_int(value);
-    } else if (is_float(value)) {
-        double v = as_float(value);
-        if (v == 1.0) {
-            return 9;
-        } else if (v == 2.0) {
-            return 10;
-        } else if (v == 0.5) {
-            return 11;
-        } else if (v == 0.0) {
-            return 12;
-        }
-    }
-    return -1;
-}
-
 /**
  * 往指定 chunk 中写入一个常量
  * @param c 指定的 chunk
@@ -108,3 +71,15 @@ inline uint16_t add_constant(Chunk *c, Value constant) {
     }
     return c->constants.count - 1;
 }
+
+/**
+ * 记录一个try块的范围。try语句的数量很少，因此每次只增长一个
+ */
+void add_exception_range(Chunk *c, int start, int end, int handler, int stack_depth) {
+    c->exceptions = GROW_ARRAY(ExceptionRange, c->exceptions, c->exception_count, c->exception_count + 1);
+    ExceptionRange *range = c->exceptions + c->exception_count++;
+    range->start = start;
+    range->end = end;
+    range->handler = handler;
+    range->stack_depth = stack_depth;
+}
@@ -77,25 +77,44 @@ typedef enum OpCode{
     OP_GET_ITERATOR, // op: [iterable] -> [iterator]
     OP_MAP_ADD_PAIR, // op, [map, k0, v0] -> [map]
     OP_NEW_MAP, // op: [] -> [map]
-    OP_SET_TRY, // op, offset16
-    OP_SKIP_CATCH, // op, offset16
     OP_THROW, // op, [value] -> ...
     OP_TEST_VALUE_OF, // op, n: [value, type1, type2, ... type_n ] -> [value, bool]
+    OP_TEST_IN, // op: [key, container] -> [bool]
+    OP_LOAD_INT8, // op, imm8: [] -> [int]。imm8视为有符号整数
+    OP_LOAD_INT16, // op, imm16: [] -> [int]。imm16视为有符号整数
+    OP_LOAD_FLOAT8, // op, imm8: [] -> [float]。用于整数值的小浮点数，例如0.0、1.0、-2.0
+    OP_TAIL_CALL, // op, arg_count: 与OP_CALL相同，但被调用的closure会取代当前的栈帧。用于return f(...)
+    OP_SWITCH, // op, index16, offset16: [value] -> [value]。const[index]是一个Map，将case的值映射为其代码的位置，跳转之。如果没有匹配的case，ip += offset16
+    OP_CALL_EXACT, // op, arg_count: 由VM改写的OP_CALL。callee是参数数量恰好匹配的closure时，直接压入栈帧；否则同OP_CALL
 } OpCode;
 
+/**
+ * try块在code中的范围[start, end)。抛出异常时，如果栈帧正在执行的指令位于该范围内，
+ * 则将栈恢复到stack_depth，并跳转到handler（第一个catch子句）。
+ * 内层的try块总是先结束，因此先于外层被记录：按顺序找到的第一个范围就是最内层的
+ */
+typedef struct ExceptionRange {
+    int start;
+    int end;
+    int handler;
+    int stack_depth; // 进入try块时，栈帧中（相对于FP）值的数量
+} ExceptionRange;
+
 typedef struct Chunk{
     int count;
     int capacity;
     uint8_t *code;
     int *lines;
     ValueArray constants;
+    int exception_count;
+    ExceptionRange *exceptions;
 } Chunk;
 
 void init_chunk(Chunk *c);
 void write_to_chunk(Chunk *c, uint8_t data, int line);
 void free_chunk(Chunk *c);
-int constant_mapping(Value value);
 uint16_t add_constant(Chunk *c, Value constant);
+void add_exception_range(Chunk *c, int start, int end, int handler, int stack_depth);
 void u16_to_u8(uint16_t value, uint8_t *i0, uint8_t *i1);
 
 #define u8_to_u16(i0, i1) ( ( ( (uint16_t) (i1) ) << 8) | (i0) )
@@ -22,8 +22,12 @@
 #define IMPLEMENTATION_CHECK
 //#define COUNT_INSTRUCTIONS_RUN
 
-#define FRAME_MAX 64
-#define STACK_MAX (FRAME_MAX * UINT8_MAX)
+#define FRAME_LIMIT_DEFAULT 65536 // 默认的调用深度上限，可由-m修改
+#define WAIT_DEPTH_LIMIT 1000 // invoke_and_wait()的最大嵌套层数。每一层都在C栈上嵌套一次run_frame_until()
+#define STACK_HEADROOM 32 // 压入栈帧时，在max_stack之外额外预留的栈空间，供native和虚拟机内部的临时值使用
+#define INITIAL_FRAME_CAPACITY 16
+#define INITIAL_STACK_CAPACITY (16 * (UINT8_MAX + 1))
+#define OUTPUT_BUFFER_SIZE (1 << 16)
 #define STR(x) #x
 #define XSTR(x) STR(x)
 
@@ -44,6 +48,6 @@ extern jmp_buf consume_buf;
 #define IMPLEMENTATION_ERROR(msg) \
     fprintf(stderr, "Implement error: %s\nOccurred in file: %s, line: %d\n", msg, __FILE__, __LINE__)
 
-#define NEW_LINE() printf("\n")
+#define NEW_LINE() putchar('\n')
 
 #endif
\ No newline at end of file
@@ -17,6 +17,9 @@
 #include "string.h"
 #include "stdlib.h"
 #include "debug.h"
+#include "vm.h"
+#include "math.h"
+#include "limits.h"
 
 typedef struct Parser {
     Token previous;
@@ -29,6 +32,13 @@ typedef struct Parser {
     int old_continue_point_depth;
     bool has_error;
     bool panic_mode;
+    int operand_start; // 正在解析的infix表达式的左操作数在字节码中的起点
+    int operand_constant_count; // 开始解析该左操作数时，常量池中常量的数量
+    int not_start; // 最近一个 ! 表达式的字节码范围为[not_start, not_end)，其末尾有not_count个连续的OP_NOT
+    int not_end;
+    int not_count;
+    int call_start; // 最近一个OP_CALL指令的范围为[call_start, call_end)。如果它是return的表达式的最后一条指令，就是尾调用
+    int call_end;
 } Parser;
 
 typedef struct ClassScope {
@@ -70,6 +80,8 @@ typedef struct Local {
     int depth;
     bool is_const;
     bool is_captured;
+    bool has_constant; // const变量的初始值是否为编译期常量。如果是，读取它时直接载入constant
+    Value constant;
 } Local;
 
 typedef struct ScopeUpValue {
@@ -85,11 +97,15 @@ typedef struct Scope {
     FunctionType functionType;
     int local_count;
     int depth;
+    int try_depth; // 当前所在的try块的层数。try块中的调用不能是尾调用，否则栈帧被取代后，异常无法被捕获
+    int *constant_slots; // 常量的去重索引：开放寻址的哈希表，每个槽储存chunk中constants的索引，-1为空槽
+    int constant_slot_capacity;
 } Scope;
 
 Parser parser;
 Scope *current_scope;
 ClassScope *current_class = NULL;
+Table constant_globals; // 初始值为编译期常量的全局const变量。仅在一次compile()中有效
 
 static Token literal_token(const char *text);
 
@@ -243,6 +259,16 @@ static void synchronize();
 
 static uint16_t make_constant(Value value);
 
+static void emit_constant(Value value);
+
+static bool constant_at(int start, int end, Value *value);
+
+static bool fold_binary(TokenType operator, int left_start, int right_start, int constant_count);
+
+static bool fold_unary(TokenType operator, int start, int constant_count);
+
+static void condition_expression();
+
 static int resolve_upvalue(Scope *scope, Token *identifier, bool *is_const);
 
 static int add_upvalue(Scope *scope, int index, bool is_local);
@@ -300,6 +326,7 @@ ParseRule rules[] = {
         [TOKEN_LEFT_BRACKET]  = {dimension_array, indexing, PREC_CALL},
         [TOKEN_RIGHT_BRACKET] = {NULL, NULL, PREC_NONE},
         [TOKEN_DOLLAR]        = {lambda, NULL, PREC_NONE},
+        [TOKEN_IN]            = {NULL, binary, PREC_COMPARISON},
 };
 
 void mark_compiler_roots() {
@@ -377,10 +404,14 @@ static void parse_precedence(Precedence precedence) {
         return;
     }
     bool can_assign = precedence <= PREC_ASSIGNMENT;
+    int start = current_chunk()->count;
+    int constant_count = current_chunk()->constants.count;
     rule->prefix(can_assign);
     while (precedence <= rules[parser.current.type].precedence) {
         // 之所以要使用 while 循环，是因为 infix 一般都不贪婪，但 parse_precedence 是贪婪的
         advance(); // 先 advance，因为 infix 函数一般假设操作符是 prev 而非 curr
+        parser.operand_start = start;
+        parser.operand_constant_count = constant_count;
 
         rules[parser.previous.type].infix(can_assign); // 这里的can_assign似乎意义不大。多数infix用不到它。对于assign对来，它自己的prefix就会处理。
     }
@@ -731,7 +762,7 @@ static void new_var_declaration(bool is_public, bool is_const) {
         if (count == UINT8_MAX) {
             error_at_previous("Cannot have more than "XSTR(UINT8_MAX)" for local variables");
         }
-        int index = parse_identifier_declaration(false);
+        int index = parse_identifier_declaration(is_const);
         indices[count++] = index;
         mark_initialized();
     } while (match(TOKEN_COMMA));
@@ -741,9 +772,20 @@ static void new_var_declaration(bool is_public, bool is_const) {
     }
 
     if (match(TOKEN_EQUAL)) {
+        int initializer = current_chunk()->count;
         expression();
+        Value constant;
         if (count > 1) {
             emit_u8_u8(OP_UNPACK_ARRAY, count);
+        } else if (is_const && constant_at(initializer, current_chunk()->count, &constant)) {
+            if (current_scope->depth > 0) {
+                Local *local = current_scope->locals + current_scope->local_count - 1;
+                local->has_constant = true;
+                local->constant = constant;
+            } else {
+                String *name = as_string(current_chunk()->constants.values[indices[0]]);
+                table_add_new(&constant_globals, name, constant, false, true);
+            }
         }
     } else if (!is_const) {
         for (int i = 0; i < count; ++i) {
@@ -795,7 +837,7 @@ static void declare_local(bool is_const, Token *token) {
  * 因为本地变量是唯一可以长时间存在的元素，一个本地变量在locals中的索引必然就是它在stack中的索引。
  *
  */
-    if (current_scope->local_count >= STACK_MAX) {
+    if (current_scope->local_count > UINT8_MAX) {
         error_at_previous("too many local variables");
         return;
     }
@@ -816,6 +858,7 @@ static void declare_local(bool is_const, Token *token) {
     local->name = *token;
     local->is_const = is_const;
     local->is_captured = false;
+    local->has_constant = false;
     local->depth = -1; // 在完成初始化之后，再设置为正确值。这是为了防止初始化中用到自己，比如`var num = num + 10;`
     current_scope->local_count++;
 }
@@ -1013,7 +1056,7 @@ static void patch_jump(int from) {
  */
 static void if_statement() {
     // condition
-    expression();
+    condition_expression();
 
     // jump to else if false
     int to_else = emit_jump(OP_POP_JUMP_IF_FALSE);
@@ -1158,7 +1201,7 @@ static void while_statement() {
     int condition = current_chunk()->count;
 
     // condition:
-    expression();
+    condition_expression();
     save_break_point();
     int to_end = emit_jump(OP_POP_JUMP_IF_FALSE);
 
@@ -1193,12 +1236,21 @@ static void switch_statement() {
 
 #define ONE_CASE_EXPR_LIMIT 64
 #define CASE_LIMIT 256
+#define SWITCH_TABLE_MIN 4 // case的值少于这个数时，逐个比较更快
 
-    static int one_case_expr[ONE_CASE_EXPR_LIMIT];
-    static int cases[CASE_LIMIT];
+    // 不能是static：case中的语句可能包含另一个switch
+    int one_case_expr[ONE_CASE_EXPR_LIMIT];
+    int cases[CASE_LIMIT];
     int one_case_count = 0;
     int case_count = 0;
 
+    // 每一个case值的字节码范围，以及匹配时跳转的位置。用于构建跳转表
+    int value_starts[CASE_LIMIT];
+    int value_ends[CASE_LIMIT];
+    int value_targets[CASE_LIMIT];
+    int value_count = 0;
+    bool all_literal = true;
+
     expression(); // [value]
 
     consume(TOKEN_LEFT_BRACE, "Expect '{' to start switch cases");
@@ -1206,8 +1258,16 @@ static void switch_statement() {
     while (match(TOKEN_CASE)) {
 
         one_case_count = 0;
+        int first_value = value_count;
         do {
+            int value_start = current_chunk()->count;
             expression(); // [value] -> [value, expr]
+            if (value_count < CASE_LIMIT) {
+                value_starts[value_count] = value_start;
+                value_ends[value_count++] = current_chunk()->count;
+            } else {
+                all_literal = false;
+            }
             one_case_expr[one_case_count++] = emit_jump(OP_JUMP_IF_EQUAL);
             emit_byte(OP_POP); // [value, expr] -> [value]
         } while (match(TOKEN_PIPE));
@@ -1222,6 +1282,11 @@ static void switch_statement() {
             patch_jump(one_case_expr[i]);
         }
 
+        // 从跳转表进入时，栈中只有[value]，因此跳过第一个POP
+        for (int i = first_value; i < value_count; ++i) {
+            value_targets[i] = current_chunk()->count + 1;
+        }
+
         // pop both value and expr. [value, expr] -> []
         emit_byte(OP_POP);
         emit_byte(OP_POP);
@@ -1234,6 +1299,7 @@ static void switch_statement() {
     }
 
     // reaching here means all cases have failed
+    int all_failed = current_chunk()->count;
     emit_byte(OP_POP); // [value] -> []
 
     if (match(TOKEN_DEFAULT)) {
@@ -1246,8 +1312,37 @@ static void switch_statement() {
         patch_jump(cases[i]);
     }
 
+    // 如果所有case的值都是Int或String常量，用Map作为跳转表，否则保留逐个比较的代码
+    Map *table = NULL;
+    if (all_literal && value_count >= SWITCH_TABLE_MIN) {
+        table = new_map();
+        for (int i = 0; i < value_count; ++i) {
+            Value value;
+            if (!constant_at(value_starts[i], value_ends[i], &value)
+                || !(is_int(value) || is_ref_of(value, OBJ_STRING))) {
+                table = NULL;
+                break;
+            }
+            map_add_native(table, value, int_value(value_targets[i])); // 与逐个比较一样，重复的值以第一个case为准
+        }
+    }
+    if (table != NULL) {
+        // 逐个比较从第一个case值开始：载入常量，然后OP_JUMP_IF_EQUAL，至少5个字节，且只能顺序执行到这里。
+        // 用OP_SWITCH, index16, offset16覆盖之，剩余的字节改为NOP。跳转表总会跳走，之后的比较不再执行
+        uint8_t *code = current_chunk()->code;
+        int table_at = value_starts[0];
+        int compare_end = value_ends[0] + 3;
+        code[table_at] = OP_SWITCH;
+        u16_to_u8(make_constant(ref_value((Object *) table)), code + table_at + 1, code + table_at + 2);
+        u16_to_u8(all_failed - (table_at + 5), code + table_at + 3, code + table_at + 4);
+        for (int i = table_at + 5; i < compare_end; ++i) {
+            code[i] = NOP;
+        }
+    }
+
 #undef ONE_CASE_EXPR_LIMIT
 #undef CASE_LIMIT
+#undef SWITCH_TABLE_MIN
 }
 
 /*
@@ -1297,7 +1392,7 @@ static void for_statement() {
 
     // condition
     if (!match(TOKEN_SEMICOLON)) {
-        expression(); // not expression_statement() because we want to keep the condition code
+        condition_expression(); // not expression_statement() because we want to keep the condition code
         consume(TOKEN_SEMICOLON, "the for initializer needs a ;");
     } else {
         emit_byte(OP_LOAD_TRUE);
@@ -1444,10 +1539,12 @@ static void call(bool can_assign) {
     (void) can_assign;
     bool arr_as_var_arg;
     int arg_count = argument_list(&arr_as_var_arg);
+    parser.call_start = current_chunk()->count;
     emit_u8_u8(OP_CALL, arg_count);
     if (arr_as_var_arg) {
         emit_byte(OP_ARR_AS_VAR_ARG);
     }
+    parser.call_end = current_chunk()->count;
 }
 
 /**
@@ -1472,6 +1569,10 @@ static inline void return_statement() {
     } else {
         expression();
         consume(TOKEN_SEMICOLON, "A semicolon is needed to terminate the statement");
+        // 调用的结果直接被返回：尾调用
+        if (parser.call_end == current_chunk()->count && current_scope->try_depth == 0) {
+            current_chunk()->code[parser.call_start] = OP_TAIL_CALL;
+        }
         emit_byte(OP_RETURN);
     }
 }
@@ -1612,6 +1713,39 @@ static void arithmetic_equal(OpCode set_op, OpCode get_op, int index, int copy)
     }
 }
 
+static inline bool check_assign() {
+    return check(TOKEN_EQUAL)
+           || check(TOKEN_PLUS_EQUAL)
+           || check(TOKEN_MINUS_EQUAL)
+           || check(TOKEN_STAR_EQUAL)
+           || check(TOKEN_SLASH_EQUAL)
+           || check(TOKEN_PERCENT_EQUAL);
+}
+
+/**
+ * 按照named_variable()的规则解析name。如果它是初始值为编译期常量的const变量，将该常量写入value
+ * 该函数没有副作用（不会添加upvalue）
+ */
+static bool resolve_constant(Token *name, Value *value) {
+    for (Scope *scope = current_scope; scope != NULL; scope = scope->enclosing) {
+        for (int i = scope->local_count - 1; i >= 0; i--) {
+            Local *local = scope->locals + i;
+            if (lexeme_equal(name, &local->name)) {
+                if (local->depth == -1 || !local->has_constant) {
+                    return false;
+                }
+                *value = local->constant;
+                return true;
+            }
+        }
+    }
+    if (constant_globals.count == 0) {
+        return false;
+    }
+    String *str = string_copy(name->start, name->length);
+    return table_get(&constant_globals, str, value);
+}
+
 static inline bool match_assign() {
     return match(TOKEN_EQUAL)
            || match(TOKEN_PLUS_EQUAL)
@@ -1631,6 +1765,11 @@ static void named_variable(Token *name, bool can_assign) {
     int get_op;
     int index;
     bool is_const = false;
+    Value constant;
+    if (!(can_assign && check_assign()) && resolve_constant(name, &constant)) {
+        emit_constant(constant);
+        return;
+    }
     if ((index = resolve_local(current_scope, name, &is_const)) != -1) {
         set_op = OP_SET_LOCAL;
         get_op = OP_GET_LOCAL;
@@ -1699,9 +1838,15 @@ static void or(bool can_assign) {
  */
 static void binary(bool can_assign) {
     (void) can_assign;
+    int left_start = parser.operand_start;
+    int constant_count = parser.operand_constant_count;
     TokenType type = parser.previous.type;
     ParseRule *rule = &rules[type];
+    int right_start = current_chunk()->count;
     parse_precedence(rule->precedence + 1); // parse the right operand
+    if (fold_binary(type, left_start, right_start, constant_count)) {
+        return;
+    }
     switch (type) {
         case TOKEN_PLUS:
             emit_byte(OP_ADD);
@@ -1742,6 +1887,9 @@ static void binary(bool can_assign) {
             emit_byte(OP_TEST_EQUAL);
             emit_byte(OP_NOT);
             break;
+        case TOKEN_IN:
+            emit_byte(OP_TEST_IN);
+            break;
         default:
             break;
     }
@@ -1753,19 +1901,43 @@ static void binary(bool can_assign) {
 static void unary(bool can_assign) {
     (void) can_assign;
     TokenType operator = parser.previous.type;
+    int start = current_chunk()->count;
+    int constant_count = current_chunk()->constants.count;
     parse_precedence(PREC_UNARY);
+    if (fold_unary(operator, start, constant_count)) {
+        return;
+    }
     switch (operator) {
         case TOKEN_MINUS:
             emit_byte(OP_NEGATE);
             break;
-        case TOKEN_BANG:
+        case TOKEN_BANG: {
+            // 操作数本身是否是一个 ! 表达式
+            bool nested = parser.not_start == start && parser.not_end == current_chunk()->count;
             emit_byte(OP_NOT);
+            parser.not_count = nested ? parser.not_count + 1 : 1;
+            parser.not_start = start;
+            parser.not_end = current_chunk()->count;
             break;
+        }
         default:
             return;
     }
 }
 
+/**
+ * 解析一个只用于判断真假的表达式（if/while/for的条件）。
+ * 在这种语境下 !!x 与 x 等价，因此去掉末尾成对的OP_NOT
+ */
+static void condition_expression() {
+    int start = current_chunk()->count;
+    expression();
+    if (parser.not_start == start && parser.not_end == current_chunk()->count && parser.not_count >= 2) {
+        current_chunk()->count -= parser.not_count & ~1;
+        parser.not_end = -1;
+    }
+}
+
 static void super_expression(bool can_assign) {
     (void) can_assign;
     if (current_class == NULL) {
@@ -1814,8 +1986,8 @@ static void try_statement() {
      *      ...
      * }
      *
-     * set_try:
-     *      ... (try body, if error thrown, jump -> catch 1)
+     * try:
+     *      ... (try body, recorded in the exception table. if error thrown, jump -> catch 1)
      *      jump -> end_catch
      *
      * catch 1:
@@ -1838,13 +2010,19 @@ static void try_statement() {
 #define CATCH_CLAUSE_LIMIT 64
     static int end_catch_jumps[CATCH_CLAUSE_LIMIT + 1];
     int patch_size = 0;
-    int end_try = emit_jump(OP_SET_TRY);
+    // entering a try block costs nothing: its range is recorded in the chunk's exception table
+    int try_start = current_chunk()->count;
+    int stack_depth = current_scope->local_count;
 
+    current_scope->try_depth++;
     declaration();
+    current_scope->try_depth--;
 
-    end_catch_jumps[patch_size++] = emit_jump(OP_SKIP_CATCH); // if no error in try, skip all catch clauses
+    int try_end = current_chunk()->count;
+    end_catch_jumps[patch_size++] = emit_jump(OP_JUMP); // if no error in try, skip all catch clauses
 
-    patch_jump(end_try); // jump to here if an error is thrown inside try
+    // jump to here if an error is thrown inside try
+    add_exception_range(current_chunk(), try_start, try_end, current_chunk()->count, stack_depth);
 
     consume(TOKEN_CATCH, "Expect 'catch' after a try block");
 
@@ -1936,15 +2114,13 @@ static void dimension_array(bool can_assign) {
 static inline void float_num(bool can_assign) {
     (void) can_assign;
     double value = strtod(parser.previous.start, NULL);
-    uint16_t index = make_constant(float_value(value));
-    emit_u8_u16(OP_LOAD_CONSTANT, index);
+    emit_constant(float_value(value));
 }
 
 static inline void int_num(bool can_assign) {
     (void) can_assign;
     int value = (int) strtol(parser.previous.start, NULL, 10);
-    uint16_t index = make_constant(int_value(value));
-    emit_u8_u16(OP_LOAD_CONSTANT, index);
+    emit_constant(int_value(value));
 }
 
 static void literal(bool can_assign) {
@@ -1987,26 +2163,537 @@ static void parse_map(bool can_assign) {
 }
 
 /**
- * 如果value属于预先装载值，那么直接返回其对应的索引。
+ * 常量去重时的相等：类型和内容都完全相同。因此1和1.0、0.0和-0.0不相等；String都是interned，比较指针即可
+ */
+static bool constant_identical(Value a, Value b) {
+    if (a.type != b.type) {
+        return false;
+    }
+    switch (a.type) {
+        case VAL_INT:
+            return as_int(a) == as_int(b);
+        case VAL_FLOAT:
+            return memcmp(&a.as.decimal, &b.as.decimal, sizeof(double)) == 0;
+        case VAL_BOOL:
+            return as_bool(a) == as_bool(b);
+        case VAL_REF:
+            return as_ref(a) == as_ref(b);
+        default:
+            return true;
+    }
+}
+
+static uint32_t constant_hash(Value value) {
+    switch (value.type) {
+        case VAL_INT:
+            return u64_hash((uint64_t) (int64_t) as_int(value));
+        case VAL_FLOAT: {
+            uint64_t bits;
+            memcpy(&bits, &value.as.decimal, sizeof(bits));
+            return u64_hash(bits);
+        }
+        case VAL_BOOL:
+            return as_bool(value);
+        case VAL_REF:
+            return u64_hash((uint64_t) (uintptr_t) as_ref(value));
+        default:
+            return 0;
+    }
+}
+
+/**
+ * 将去重索引的容量翻倍，并重新放置所有已有的常量
+ */
+static void grow_constant_slots(Scope *scope) {
+    int old_capacity = scope->constant_slot_capacity;
+    int *old_slots = scope->constant_slots;
+    int capacity = old_capacity < 16 ? 16 : old_capacity * 2;
+    int *slots = ALLOCATE(int, capacity);
+    for (int i = 0; i < capacity; ++i) {
+        slots[i] = -1;
+    }
+    Value *constants = scope->function->chunk.constants.values;
+    for (int i = 0; i < old_capacity; ++i) {
+        if (old_slots[i] != -1) {
+            uint32_t slot = constant_hash(constants[old_slots[i]]) & (capacity - 1);
+            while (slots[slot] != -1) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            slots[slot] = old_slots[i];
+        }
+    }
+    FREE_ARRAY(int, old_slots, old_capacity);
+    scope->constant_slots = slots;
+    scope->constant_slot_capacity = capacity;
+}
+
+/**
+ * 如果同一个chunk中已经有相同的常量，返回它的索引。
  * 否则将指定的 value 作为常数储存到 vm.code.constants 之中，然后返回其索引.
  * 该函数包装了 add_constant
  * @return 常数的索引
  * */
 static uint16_t make_constant(Value value) {
-    int cache = constant_mapping(value);
-    if (cache != -1) {
-        return cache;
+    Scope *scope = current_scope;
+    // 负载因子不超过3/4
+    if ((current_chunk()->constants.count + 1) * 4 > scope->constant_slot_capacity * 3) {
+        grow_constant_slots(scope);
+    }
+    int mask = scope->constant_slot_capacity - 1;
+    uint32_t slot = constant_hash(value) & mask;
+    while (scope->constant_slots[slot] != -1) {
+        int existing = scope->constant_slots[slot];
+        if (constant_identical(current_chunk()->constants.values[existing], value)) {
+            return existing;
+        }
+        slot = (slot + 1) & mask;
     }
     uint16_t index = add_constant(current_chunk(), value);
+    scope->constant_slots[slot] = index;
     return index;
 }
 
+/**
+ * 产生载入value的指令。nil、true、false有专门的指令；
+ * 小整数和整数值的小浮点数作为立即数写入指令，不占用常量池
+ */
+static void emit_constant(Value value) {
+    if (is_nil(value)) {
+        emit_byte(OP_LOAD_NIL);
+    } else if (is_bool(value)) {
+        emit_byte(as_bool(value) ? OP_LOAD_TRUE : OP_LOAD_FALSE);
+    } else if (is_int(value) && as_int(value) >= INT8_MIN && as_int(value) <= INT8_MAX) {
+        emit_u8_u8(OP_LOAD_INT8, (uint8_t) (int8_t) as_int(value));
+    } else if (is_int(value) && as_int(value) >= INT16_MIN && as_int(value) <= INT16_MAX) {
+        emit_u8_u16(OP_LOAD_INT16, (uint16_t) (int16_t) as_int(value));
+    } else if (is_float(value) && as_float(value) >= INT8_MIN && as_float(value) <= INT8_MAX
+               && as_float(value) == (int8_t) as_float(value)
+               && !(as_float(value) == 0 && signbit(as_float(value)))) { // -0.0不能表示为立即数
+        emit_u8_u8(OP_LOAD_FLOAT8, (uint8_t) (int8_t) as_float(value));
+    } else {
+        emit_u8_u16(OP_LOAD_CONSTANT, make_constant(value));
+    }
+}
+
+/**
+ * 如果当前chunk中[start, end)的字节码恰好是一条载入常量的指令，将该常量写入value
+ */
+static bool constant_at(int start, int end, Value *value) {
+    Chunk *chunk = current_chunk();
+    if (end - start == 1) {
+        switch (chunk->code[start]) {
+            case OP_LOAD_NIL:
+                *value = nil_value();
+                return true;
+            case OP_LOAD_TRUE:
+                *value = bool_value(true);
+                return true;
+            case OP_LOAD_FALSE:
+                *value = bool_value(false);
+                return true;
+            default:
+                return false;
+        }
+    }
+    if (end - start == 2 && chunk->code[start] == OP_LOAD_INT8) {
+        *value = int_value((int8_t) chunk->code[start + 1]);
+        return true;
+    }
+    if (end - start == 2 && chunk->code[start] == OP_LOAD_FLOAT8) {
+        *value = float_value((int8_t) chunk->code[start + 1]);
+        return true;
+    }
+    if (end - start == 3 && chunk->code[start] == OP_LOAD_INT16) {
+        *value = int_value((int16_t) u8_to_u16(chunk->code[start + 1], chunk->code[start + 2]));
+        return true;
+    }
+    if (end - start == 3 && chunk->code[start] == OP_LOAD_CONSTANT) {
+        *value = chunk->constants.values[u8_to_u16(chunk->code[start + 1], chunk->code[start + 2])];
+        return true;
+    }
+    return false;
+}
+
+/**
+ * 与虚拟机的binary_number_op()相同的数字运算。int的溢出按补码回绕。
+ * @return 如果运行时会抛出异常（或者除以0），返回false，不进行折叠
+ */
+static bool evaluate_number_op(TokenType operator, Value a, Value b, Value *result) {
+    if (!is_number(a) || !is_number(b)) {
+        return false;
+    }
+    if (is_int(a) && is_int(b)) {
+        int x = as_int(a);
+        int y = as_int(b);
+        switch (operator) {
+            case TOKEN_PLUS:
+                *result = int_value((int) ((unsigned) x + (unsigned) y));
+                return true;
+            case TOKEN_MINUS:
+                *result = int_value((int) ((unsigned) x - (unsigned) y));
+                return true;
+            case TOKEN_STAR:
+                *result = int_value((int) ((unsigned) x * (unsigned) y));
+                return true;
+            case TOKEN_SLASH:
+            case TOKEN_PERCENT: {
+                if (y == 0 || (x == INT_MIN && y == -1)) {
+                    return false;
+                }
+                int mod = x % y;
+                *result = int_value(operator == TOKEN_SLASH ? x / y : (mod < 0 ? mod + y : mod));
+                return true;
+            }
+            case TOKEN_LESS:
+                *result = bool_value(x < y);
+                return true;
+            case TOKEN_GREATER:
+                *result = bool_value(x > y);
+                return true;
+            default:
+                return false;
+        }
+    }
+    double x = AS_NUMBER(a);
+    double y = AS_NUMBER(b);
+    switch (operator) {
+        case TOKEN_PLUS:
+            *result = float_value(x + y);
+            return true;
+        case TOKEN_MINUS:
+            *result = float_value(x - y);
+            return true;
+        case TOKEN_STAR:
+            *result = float_value(x * y);
+            return true;
+        case TOKEN_SLASH:
+            *result = float_value(x / y);
+            return true;
+        case TOKEN_LESS:
+            *result = bool_value(x < y);
+            return true;
+        case TOKEN_GREATER:
+            *result = bool_value(x > y);
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * 在编译期计算 a operator b，结果与运行时完全相同
+ * @return 如果不能在编译期计算（例如运行时会抛出异常），返回false
+ */
+static bool evaluate_binary(TokenType operator, Value a, Value b, Value *result) {
+    switch (operator) {
+        case TOKEN_EQUAL_EQUAL:
+        case TOKEN_BANG_EQUAL:
+            *result = bool_value(value_equal(a, b) == (operator == TOKEN_EQUAL_EQUAL));
+            return true;
+        case TOKEN_LESS_EQUAL:
+        case TOKEN_GREATER_EQUAL:
+            // 与运行时一样，a <= b 是 !(a > b)
+            if (!evaluate_number_op(operator == TOKEN_LESS_EQUAL ? TOKEN_GREATER : TOKEN_LESS, a, b, result)) {
+                return false;
+            }
+            *result = bool_value(!as_bool(*result));
+            return true;
+        case TOKEN_STAR_STAR:
+            if (!is_number(a) || !is_number(b)) {
+                return false;
+            }
+            *result = float_value(pow(AS_NUMBER(a), AS_NUMBER(b)));
+            return true;
+        case TOKEN_PLUS:
+            if (is_ref_of(a, OBJ_STRING) || is_ref_of(b, OBJ_STRING)) {
+                *result = ref_value((Object *) string_intern(string_concat(a, b)));
+                return true;
+            }
+            return evaluate_number_op(operator, a, b, result);
+        default:
+            return evaluate_number_op(operator, a, b, result);
+    }
+}
+
+/**
+ * 移除常量池中索引不小于count的常量，并将它们从去重索引中删除。
+ * 它们由被折叠的操作数添加，除了被替换掉的指令之外没有其他引用。
+ * 按照添加的逆序删除：最后添加的常量位于其探测序列的末端，清空它的槽不会截断其他常量的探测序列
+ */
+static void drop_constants_since(int count) {
+    Scope *scope = current_scope;
+    ValueArray *constants = &current_chunk()->constants;
+    int mask = scope->constant_slot_capacity - 1;
+    while (constants->count > count) {
+        int index = --constants->count;
+        uint32_t slot = constant_hash(constants->values[index]) & mask;
+        while (scope->constant_slots[slot] != index) {
+            slot = (slot + 1) & mask;
+        }
+        scope->constant_slots[slot] = -1;
+    }
+}
+
+/**
+ * 如果左右操作数都是常量，并且运算可以在编译期完成，那么用结果替换两个操作数的字节码
+ * @param constant_count 开始解析左操作数时常量池中常量的数量。操作数添加的常量随之移除
+ * @return 是否进行了折叠
+ */
+static bool fold_binary(TokenType operator, int left_start, int right_start, int constant_count) {
+    Value a, b, result;
+    if (!constant_at(left_start, right_start, &a)
+        || !constant_at(right_start, current_chunk()->count, &b)
+        || !evaluate_binary(operator, a, b, &result)) {
+        return false;
+    }
+    current_chunk()->count = left_start;
+    drop_constants_since(constant_count);
+    emit_constant(result);
+    return true;
+}
+
+/**
+ * 如果操作数是常量，用 -value 或 !value 替换它的字节码
+ * @param constant_count 开始解析操作数时常量池中常量的数量。操作数添加的常量随之移除
+ * @return 是否进行了折叠
+ */
+static bool fold_unary(TokenType operator, int start, int constant_count) {
+    Value value;
+    if (!constant_at(start, current_chunk()->count, &value)) {
+        return false;
+    }
+    if (operator == TOKEN_MINUS && is_int(value)) {
+        value = int_value((int) (0u - (unsigned) as_int(value)));
+    } else if (operator == TOKEN_MINUS && is_float(value)) {
+        value = float_value(-as_float(value));
+    } else if (operator == TOKEN_BANG) {
+        value = bool_value(is_nil(value) || (is_bool(value) && !as_bool(value)));
+    } else {
+        return false;
+    }
+    current_chunk()->count = start;
+    drop_constants_since(constant_count);
+    emit_constant(value);
+    return true;
+}
+
+/**
+ * 记录offset处的指令开始执行时栈帧中值的数量。只在数量增加时（重新）加入待处理的列表
+ */
+static void visit_depth(int offset, int depth, int *depths, bool *queued, int *pending, int *pending_count) {
+    if (depth <= depths[offset] || depth > UINT16_MAX) {
+        return;
+    }
+    depths[offset] = depth;
+    if (!queued[offset]) {
+        queued[offset] = true;
+        pending[(*pending_count)++] = offset;
+    }
+}
+
+/**
+ * 按照每条指令对栈的影响，沿着所有可能的执行路径（包括每个catch的入口）遍历chunk，
+ * 求出栈帧中（相对于FP）同时存在的值的最大数量。虚拟机压入栈帧时据此预留栈空间
+ */
+static int max_stack_depth(LoxFunction *function) {
+    Chunk *chunk = &function->chunk;
+    int *depths = ALLOCATE(int, chunk->count);
+    bool *queued = ALLOCATE(bool, chunk->count);
+    int *pending = ALLOCATE(int, chunk->count);
+    int pending_count = 0;
+    for (int i = 0; i < chunk->count; ++i) {
+        depths[i] = -1;
+        queued[i] = false;
+    }
+
+    // 栈帧开始时：callee和所有参数
+    int max = 1 + function->fixed_arg_count + function->optional_arg_count + (function->var_arg ? 1 : 0);
+    visit_depth(0, max, depths, queued, pending, &pending_count);
+    for (int i = 0; i < chunk->exception_count; ++i) {
+        ExceptionRange *range = chunk->exceptions + i;
+        visit_depth(range->handler, range->stack_depth + 1, depths, queued, pending, &pending_count); // 被抛出的值
+    }
+
+    while (pending_count > 0) {
+        int offset = pending[--pending_count];
+        queued[offset] = false;
+        int depth = depths[offset];
+        uint8_t *code = chunk->code + offset;
+        uint16_t operand = offset + 2 < chunk->count ? u8_to_u16(code[1], code[2]) : 0;
+        int length = 1;
+        int effect = 0;
+        int target = -1; // 跳转的目标，其栈深度为执行后的深度
+        bool falls_through = true;
+        switch (code[0]) {
+            case OP_RETURN:
+            case OP_THROW:
+                falls_through = false;
+                break;
+            case OP_LOAD_NIL:
+            case OP_LOAD_TRUE:
+            case OP_LOAD_FALSE:
+            case OP_LOAD_ABSENCE:
+            case OP_NEW_MAP:
+            case OP_COPY:
+                effect = 1;
+                break;
+            case OP_COPY2:
+                effect = 2;
+                break;
+            case OP_LOAD_INT8:
+            case OP_LOAD_FLOAT8:
+            case OP_GET_LOCAL:
+            case OP_GET_UPVALUE:
+            case OP_COPY_N:
+                length = 2;
+                effect = 1;
+                break;
+            case OP_LOAD_CONSTANT:
+            case OP_LOAD_INT16:
+            case OP_GET_GLOBAL:
+            case OP_MAKE_CLASS:
+                length = 3;
+                effect = 1;
+                break;
+            case OP_ADD:
+            case OP_SUBTRACT:
+            case OP_MULTIPLY:
+            case OP_DIVIDE:
+            case OP_MOD:
+            case OP_POWER:
+            case OP_TEST_LESS:
+            case OP_TEST_GREATER:
+            case OP_TEST_EQUAL:
+            case OP_TEST_IN:
+            case OP_PRINT:
+            case OP_REPL_AUTO_PRINT:
+            case OP_POP:
+            case OP_CLOSE_UPVALUE:
+            case OP_MAKE_METHOD:
+            case OP_INHERIT:
+            case OP_INDEXING_GET:
+                effect = -1;
+                break;
+            case OP_INDEXING_SET:
+            case OP_MAP_ADD_PAIR:
+                effect = -2;
+                break;
+            case OP_DEF_GLOBAL:
+            case OP_DEF_GLOBAL_CONST:
+            case OP_DEF_PUB_GLOBAL:
+            case OP_DEF_PUB_GLOBAL_CONST:
+            case OP_SET_PROPERTY:
+            case OP_SUPER_ACCESS:
+            case OP_MAKE_STATIC_FIELD:
+                length = 3;
+                effect = -1;
+                break;
+            case OP_SET_GLOBAL:
+            case OP_GET_PROPERTY:
+            case OP_EXPORT:
+                length = 3;
+                break;
+            case OP_SET_LOCAL:
+            case OP_SET_UPVALUE:
+            case OP_SWAP:
+                length = 2;
+                break;
+            case OP_CALL:
+            case OP_CALL_EXACT:
+            case OP_TAIL_CALL:
+                length = 2;
+                effect = -code[1];
+                break;
+            case OP_MAKE_ARRAY:
+            case OP_DIMENSION_ARRAY:
+            case OP_TEST_VALUE_OF:
+                length = 2;
+                effect = 1 - code[1];
+                break;
+            case OP_UNPACK_ARRAY:
+                length = 2;
+                effect = code[1] - 1;
+                break;
+            case OP_PROPERTY_INVOKE:
+                length = 4;
+                effect = -code[3];
+                break;
+            case OP_SUPER_INVOKE:
+                length = 4;
+                effect = -code[3] - 1;
+                break;
+            case OP_MAKE_CLOSURE:
+                length = 3 + 2 * as_function(chunk->constants.values[operand])->upvalue_count;
+                effect = 1;
+                break;
+            case OP_JUMP_IF_FALSE:
+            case OP_JUMP_IF_TRUE:
+            case OP_JUMP_IF_NOT_EQUAL:
+            case OP_JUMP_IF_EQUAL:
+                length = 3;
+                target = offset + 3 + operand;
+                break;
+            case OP_POP_JUMP_IF_FALSE:
+            case OP_POP_JUMP_IF_TRUE:
+            case OP_JUMP_IF_NOT_ABSENCE:
+                length = 3;
+                effect = -1;
+                target = offset + 3 + operand;
+                break;
+            case OP_JUMP:
+                length = 3;
+                target = offset + 3 + operand;
+                falls_through = false;
+                break;
+            case OP_JUMP_BACK:
+                length = 3;
+                target = offset + 3 - operand;
+                falls_through = false;
+                break;
+            case OP_JUMP_FOR_ITER:
+                // 没有下一个元素时跳转，栈不变；否则将元素置于栈顶
+                length = 3;
+                visit_depth(offset + 3 + operand, depth, depths, queued, pending, &pending_count);
+                effect = 1;
+                break;
+            case OP_SWITCH: {
+                length = 5;
+                Map *table = as_map(chunk->constants.values[operand]);
+                for (int i = 0; i < map_length(table); ++i) {
+                    visit_depth(as_int(table->backing[i].value), depth, depths, queued, pending, &pending_count);
+                }
+                target = offset + 5 + u8_to_u16(code[3], code[4]);
+                break;
+            }
+            default: // OP_NEGATE, OP_NOT, OP_IMPORT, OP_RESTORE_MODULE, OP_GET_ITERATOR, OP_ARR_AS_VAR_ARG, NOP...
+                break;
+        }
+        depth += effect;
+        if (depth > max) {
+            max = depth;
+        }
+        if (target >= 0 && target < chunk->count) {
+            visit_depth(target, depth, depths, queued, pending, &pending_count);
+        }
+        if (falls_through && offset + length < chunk->count) {
+            visit_depth(offset + length, depth, depths, queued, pending, &pending_count);
+        }
+    }
+
+    FREE_ARRAY(int, depths, chunk->count);
+    FREE_ARRAY(bool, queued, chunk->count);
+    FREE_ARRAY(int, pending, chunk->count);
+    return max;
+}
+
 /**
  * 将当前scope中的函数返回。切换回到上一层scope
  */
 static LoxFunction *end_compiler() {
     emit_return();
     LoxFunction *function = current_scope->function;
+    settle_call_shape(function);
+    function->max_stack = max_stack_depth(function);
     if (SHOW_COMPILE_RESULT && !parser.has_error) {
         if (function->type == TYPE_MAIN) {
             disassemble_chunk(current_chunk(), "<main>");
@@ -2016,7 +2703,10 @@ static LoxFunction *end_compiler() {
             disassemble_chunk(current_chunk(), function->name->chars);
         }
     }
+    FREE_ARRAY(int, current_scope->constant_slots, current_scope->constant_slot_capacity);
     current_scope = current_scope->enclosing;
+    parser.not_end = -1;
+    parser.call_end = -1;
     return function;
 }
 
@@ -2169,6 +2859,7 @@ static void error_at(Token *token, const char *message) {
         return;
     }
     parser.panic_mode = true;
+    fflush(stdout);
     fprintf(stderr, "[line %d] Compile Error", token->line);
     if (token->type == TOKEN_EOF) {
         fprintf(stderr, " at end");
@@ -2215,6 +2906,9 @@ static void set_new_scope(Scope *scope, FunctionType type) {
     scope->function = NULL;
     scope->depth = 0;
     scope->local_count = 0;
+    scope->try_depth = 0;
+    scope->constant_slots = NULL;
+    scope->constant_slot_capacity = 0;
 
     String *name = NULL;
     if (type == TYPE_FUNCTION || type == TYPE_METHOD || type == TYPE_INITIALIZER) {
@@ -2223,6 +2917,8 @@ static void set_new_scope(Scope *scope, FunctionType type) {
     scope->function = new_function(type);
     init_chunk(&scope->function->chunk);
     scope->function->name = name;
+    parser.not_end = -1; // 记录的范围属于上一个chunk
+    parser.call_end = -1;
 
     if (type == TYPE_MAIN) {
         scope->enclosing = NULL;
@@ -2248,6 +2944,8 @@ static void set_new_scope(Scope *scope, FunctionType type) {
 static void init_parser(Parser *the_parser) {
     the_parser->continue_point = -1;
     the_parser->break_point = -1;
+    the_parser->not_end = -1;
+    the_parser->call_end = -1;
 }
 
 /**
@@ -2261,6 +2959,7 @@ LoxFunction *compile(const char *src) {
 
     init_scanner(src);
     init_parser(&parser);
+    init_table(&constant_globals);
 
     Scope scope;
     set_new_scope(&scope, TYPE_MAIN);
@@ -2272,6 +2971,7 @@ LoxFunction *compile(const char *src) {
     }
 
     LoxFunction *function = end_compiler();
+    free_table(&constant_globals);
 
     ENABLE_GC;
 
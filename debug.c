@@ -21,6 +21,10 @@ int disassemble_chunk(Chunk *chunk, const char *name) {
             return - 1;
         }
     }
+    for (int i = 0; i < chunk->exception_count; ++i) {
+        ExceptionRange *range = chunk->exceptions + i;
+        printf("try [%04d, %04d) -> %04d, stack depth: %d\n", range->start, range->end, range->handler, range->stack_depth);
+    }
     NEW_LINE();
     return 0;
 }
@@ -50,6 +54,16 @@ static int constant16_instruction(const char *name, const Chunk *chunk, int offs
     return offset + 3;
 }
 
+/**
+ * 打印一个以立即数为操作数的载入指令，例如LOAD_INT8
+ */
+static int immediate_instruction(const char *name, Value value, int offset, int length) {
+    printf("%-23s ", name);
+    print_value_with_color(value);
+    NEW_LINE();
+    return offset + length;
+}
+
 static int invoke_instruction(const char *name, const Chunk *chunk, int offset) {
     uint8_t name_index0 = chunk->code[offset + 1];
     uint8_t name_index1 = chunk->code[offset + 2];
@@ -120,6 +134,14 @@ int disassemble_instruction(Chunk *chunk, int offset, bool line_break) {
             return simple_instruction("LOAD_TRUE", offset);
         case OP_LOAD_FALSE:
             return simple_instruction("LOAD_FALSE", offset);
+        case OP_LOAD_INT8:
+            return immediate_instruction("LOAD_INT8", int_value((int8_t) chunk->code[offset + 1]), offset, 2);
+        case OP_LOAD_INT16: {
+            int16_t value = (int16_t) u8_to_u16(chunk->code[offset + 1], chunk->code[offset + 2]);
+            return immediate_instruction("LOAD_INT16", int_value(value), offset, 3);
+        }
+        case OP_LOAD_FLOAT8:
+            return immediate_instruction("LOAD_FLOAT8", float_value((int8_t) chunk->code[offset + 1]), offset, 2);
         case OP_NOT:
             return simple_instruction("NOT", offset);
         case OP_TEST_EQUAL:
@@ -162,6 +184,10 @@ int disassemble_instruction(Chunk *chunk, int offset, bool line_break) {
             return jump_instruction("POP_JUMP_IF_TRUE", chunk, offset, true);
         case OP_CALL:
             return byte_instruction("CALL", chunk, offset, "arg #");
+        case OP_CALL_EXACT:
+            return byte_instruction("CALL_EXACT", chunk, offset, "arg #");
+        case OP_TAIL_CALL:
+            return byte_instruction("TAIL_CALL", chunk, offset, "arg #");
         case OP_GET_UPVALUE:
             return byte_instruction("GET_UPVALUE", chunk, offset, "index");
         case OP_SET_UPVALUE:
@@ -246,16 +272,25 @@ int disassemble_instruction(Chunk *chunk, int offset, bool line_break) {
             return simple_instruction("MAP_ADD_PAIR", offset);
         case OP_NEW_MAP:
             return simple_instruction("NEW_MAP", offset);
-        case OP_SET_TRY:
-            return jump_instruction("SET_TRY", chunk, offset, true);
-        case OP_SKIP_CATCH:
-            return jump_instruction("SKIP_CATCH", chunk, offset, true);
         case OP_THROW:
             return simple_instruction("THROW", offset);
+        case OP_TEST_IN:
+            return simple_instruction("TEST_IN", offset);
         case OP_TEST_VALUE_OF:
             return byte_instruction("TEST_VALUE_OF", chunk, offset, "amount");
         case OP_JUMP_IF_EQUAL:
             return jump_instruction("JUMP_IF_EQUAL", chunk, offset, true);
+        case OP_SWITCH: {
+            uint16_t index = u8_to_u16(chunk->code[offset + 1], chunk->code[offset + 2]);
+            uint16_t jump = u8_to_u16(chunk->code[offset + 3], chunk->code[offset + 4]);
+            Map *table = as_map(chunk->constants.values[index]);
+            printf("%-23s ", "SWITCH");
+            start_color(GRAY);
+            printf("%d: %d cases, default -> %d", index, table->active_count, offset + 5 + jump);
+            end_color();
+            NEW_LINE();
+            return offset + 5;
+        }
         default:
             printf("Unknown instruction: %d\n", instruction);
             return -1;
@@ -3,6 +3,7 @@
 //
 
 #include "io.h"
+#include "vm.h"
 #include "stdlib.h"
 
 static void write_string(FILE *file, String *string);
@@ -29,8 +30,20 @@ static void write_value(FILE *file, Value *value) {
             case OBJ_FUNCTION:
                 write_function(file, (LoxFunction *) ref);
                 break;
+            case OBJ_MAP: {
+                // switch的跳转表。读取时重新插入，因为hash与进程相关
+                Map *map = (Map *) ref;
+                fwrite(&map->active_count, sizeof(int ), 1, file);
+                for (int i = 0; i < map_length(map); ++i) {
+                    if (!is_absence(map->backing[i].key)) {
+                        write_value(file, &map->backing[i].key);
+                        write_value(file, &map->backing[i].value);
+                    }
+                }
+                break;
+            }
             default:
-                IMPLEMENTATION_ERROR("only expect string or function");
+                IMPLEMENTATION_ERROR("only expect string, function or map");
                 break;
         }
     }
@@ -50,6 +63,18 @@ static Value read_value(FILE *file) {
             case OBJ_FUNCTION:
                 value.as.reference = (Object *) read_function(file);
                 break;
+            case OBJ_MAP: {
+                Map *map = new_map();
+                int count;
+                fread(&count, sizeof(int ), 1, file);
+                for (int i = 0; i < count; ++i) {
+                    Value key = read_value(file);
+                    Value entry_value = read_value(file);
+                    map_add_native(map, key, entry_value);
+                }
+                value.as.reference = (Object *) map;
+                break;
+            }
             default:
                 IMPLEMENTATION_ERROR("bad");
                 return nil_value();
@@ -63,6 +88,8 @@ static void write_chunk(FILE *file, Chunk *chunk) {
     fwrite(chunk->code, sizeof(uint8_t), chunk->count, file);
     fwrite(chunk->lines, sizeof(int ), chunk->count, file);
     write_valueArray(file, &chunk->constants);
+    fwrite(&chunk->exception_count, sizeof(int ), 1, file);
+    fwrite(chunk->exceptions, sizeof(ExceptionRange), chunk->exception_count, file);
 }
 
 static Chunk read_chunk(FILE *file) {
@@ -74,6 +101,9 @@ static Chunk read_chunk(FILE *file) {
     fread(chunk.code, sizeof(uint8_t), chunk.count, file);
     fread(chunk.lines, sizeof(int ), chunk.count, file);
     chunk.constants = read_valueArray(file);
+    fread(&chunk.exception_count, sizeof(int ), 1, file);
+    chunk.exceptions = malloc(sizeof(ExceptionRange) * chunk.exception_count);
+    fread(chunk.exceptions, sizeof(ExceptionRange), chunk.exception_count, file);
     return chunk;
 }
 
@@ -103,7 +133,7 @@ static String *read_string(FILE *file) {
     }
     text = malloc(length + 1);
     fread(text, 1, length + 1, file);
-    return string_allocate(text, length);
+    return string_intern(string_allocate(text, length)); // 常量和标识符需要被intern
 }
 
 void write_function(FILE *file, LoxFunction *function) {
@@ -114,6 +144,7 @@ void write_function(FILE *file, LoxFunction *function) {
     write_chunk(file, & function->chunk);
     write_string(file, function->name);
     fwrite(&function->upvalue_count, sizeof(int ), 1, file);
+    fwrite(&function->max_stack, sizeof(int ), 1, file);
 }
 
 LoxFunction *read_function(FILE *file) {
@@ -122,9 +153,11 @@ LoxFunction *read_function(FILE *file) {
     fread(&function->fixed_arg_count, sizeof(int ), 1, file);
     fread(&function->optional_arg_count, sizeof(short ), 1, file);
     fread(&function->var_arg, sizeof(bool), 1, file);
+    settle_call_shape(function);
     function->chunk = read_chunk(file);
     function->name = read_string(file);
     fread(&function->upvalue_count, sizeof(int ), 1, file);
+    fread(&function->max_stack, sizeof(int ), 1, file);
     return function;
 }
 
@@ -0,0 +1,920 @@
+unsigned char liblox_data_structure[] = {
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75,
+  0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x13, 0x00, 0x00, 0x15, 0x00, 0x00,
+  0x24, 0x02, 0x00, 0x36, 0x01, 0x00, 0x24, 0x03, 0x00, 0x29, 0x24, 0x04,
+  0x00, 0x29, 0x24, 0x05, 0x00, 0x29, 0x24, 0x06, 0x00, 0x29, 0x24, 0x07,
+  0x00, 0x29, 0x12, 0x26, 0x08, 0x00, 0x13, 0x08, 0x00, 0x15, 0x08, 0x00,
+  0x24, 0x09, 0x00, 0x36, 0x01, 0x00, 0x24, 0x0a, 0x00, 0x29, 0x24, 0x0b,
+  0x00, 0x29, 0x24, 0x0c, 0x00, 0x29, 0x24, 0x0d, 0x00, 0x29, 0x24, 0x0e,
+  0x00, 0x29, 0x24, 0x0f, 0x00, 0x29, 0x24, 0x10, 0x00, 0x29, 0x24, 0x11,
+  0x00, 0x29, 0x12, 0x26, 0x12, 0x00, 0x13, 0x12, 0x00, 0x15, 0x13, 0x00,
+  0x15, 0x12, 0x00, 0x2b, 0x15, 0x12, 0x00, 0x24, 0x14, 0x00, 0x29, 0x12,
+  0x12, 0x3d, 0x00, 0x00, 0x3d, 0x08, 0x00, 0x3d, 0x12, 0x00, 0x09, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+  0x57, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+  0x6b, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0x90, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xb4, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0xca, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0xcd, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+  0xd1, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+  0x48, 0x61, 0x73, 0x68, 0x4d, 0x61, 0x70, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x90, 0x31, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x77, 0x69, 0x74, 0x68, 0x5f, 0x63, 0x61, 0x70,
+  0x61, 0x63, 0x69, 0x74, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf0, 0x31,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+  0x00, 0x15, 0x00, 0x00, 0x23, 0x00, 0x17, 0x02, 0x17, 0x01, 0x28, 0x01,
+  0x00, 0x12, 0x17, 0x02, 0x17, 0x01, 0x48, 0x03, 0x33, 0x02, 0x28, 0x02,
+  0x00, 0x12, 0x17, 0x02, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a,
+  0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b,
+  0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0xc0, 0x30, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x48, 0x61, 0x73, 0x68, 0x4d,
+  0x61, 0x70, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa0, 0x33, 0x6f, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x63,
+  0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x77, 0x69, 0x74, 0x68,
+  0x5f, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf0, 0x35,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x48, 0x00, 0x28, 0x00, 0x00, 0x12, 0x17, 0x00, 0x48,
+  0x00, 0x28, 0x01, 0x00, 0x12, 0x17, 0x00, 0x48, 0x00, 0x33, 0x01, 0x28,
+  0x02, 0x00, 0x12, 0x17, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x11, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x36,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa0,
+  0x33, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b,
+  0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x38, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x00, 0x48, 0x00, 0x0f, 0x21, 0x05, 0x00, 0x09, 0x00, 0x1e, 0x00, 0x00,
+  0x17, 0x01, 0x2a, 0x01, 0x00, 0x00, 0x17, 0x00, 0x27, 0x02, 0x00, 0x17,
+  0x02, 0x17, 0x03, 0x07, 0x15, 0x03, 0x00, 0x17, 0x03, 0x23, 0x01, 0x42,
+  0x1b, 0x59, 0x00, 0x41, 0x57, 0x00, 0x17, 0x04, 0x17, 0x06, 0x03, 0x17,
+  0x03, 0x07, 0x17, 0x00, 0x27, 0x04, 0x00, 0x17, 0x07, 0x31, 0x17, 0x08,
+  0x48, 0x00, 0x31, 0x17, 0x08, 0x48, 0x01, 0x31, 0x17, 0x08, 0x48, 0x02,
+  0x31, 0x17, 0x09, 0x09, 0x0f, 0x1b, 0x05, 0x00, 0x12, 0x17, 0x0a, 0x09,
+  0x0f, 0x21, 0x05, 0x00, 0x09, 0x00, 0x1e, 0x1a, 0x00, 0x17, 0x0b, 0x17,
+  0x02, 0x0f, 0x1b, 0x09, 0x00, 0x12, 0x17, 0x09, 0x17, 0x01, 0x2a, 0x05,
+  0x00, 0x01, 0x21, 0x06, 0x00, 0x17, 0x0a, 0x00, 0x1e, 0x00, 0x00, 0x12,
+  0x12, 0x12, 0x12, 0x12, 0x12, 0x1d, 0x59, 0x00, 0x12, 0x12, 0x09, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00,
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00,
+  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
+  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00,
+  0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00,
+  0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00,
+  0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x25, 0x00,
+  0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x36,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60,
+  0x7a, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x68, 0x61, 0x73, 0x68, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xa0, 0x33, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x2a, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x72, 0x61, 0x6e,
+  0x67, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62,
+  0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd0,
+  0x77, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x35, 0x6f,
+  0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00,
+  0x17, 0x03, 0x3f, 0x09, 0x00, 0x17, 0x01, 0x2a, 0x00, 0x00, 0x00, 0x18,
+  0x03, 0x12, 0x17, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x12, 0x17, 0x00, 0x27,
+  0x02, 0x00, 0x17, 0x03, 0x17, 0x04, 0x07, 0x09, 0x15, 0x03, 0x00, 0x17,
+  0x04, 0x23, 0x01, 0x42, 0x1b, 0xbe, 0x00, 0x41, 0xbc, 0x00, 0x17, 0x05,
+  0x17, 0x08, 0x03, 0x17, 0x04, 0x07, 0x17, 0x00, 0x27, 0x04, 0x00, 0x17,
+  0x09, 0x31, 0x17, 0x0a, 0x48, 0x00, 0x31, 0x17, 0x0a, 0x48, 0x01, 0x31,
+  0x17, 0x0a, 0x48, 0x02, 0x31, 0x17, 0x0b, 0x09, 0x0f, 0x1b, 0x05, 0x00,
+  0x12, 0x17, 0x0c, 0x09, 0x0f, 0x21, 0x4c, 0x00, 0x17, 0x06, 0x09, 0x0f,
+  0x21, 0x28, 0x00, 0x17, 0x0a, 0x48, 0x00, 0x17, 0x01, 0x32, 0x12, 0x17,
+  0x0a, 0x48, 0x01, 0x17, 0x02, 0x32, 0x12, 0x17, 0x0a, 0x48, 0x02, 0x17,
+  0x03, 0x32, 0x12, 0x17, 0x00, 0x2e, 0x27, 0x05, 0x00, 0x48, 0x01, 0x03,
+  0x28, 0x05, 0x00, 0x12, 0x1e, 0x18, 0x00, 0x17, 0x06, 0x48, 0x00, 0x17,
+  0x01, 0x32, 0x12, 0x17, 0x06, 0x48, 0x01, 0x17, 0x02, 0x32, 0x12, 0x17,
+  0x06, 0x48, 0x02, 0x17, 0x03, 0x32, 0x12, 0x09, 0x00, 0x1e, 0x38, 0x00,
+  0x17, 0x0d, 0x17, 0x03, 0x0f, 0x1b, 0x09, 0x00, 0x12, 0x17, 0x0b, 0x17,
+  0x01, 0x2a, 0x06, 0x00, 0x01, 0x21, 0x0d, 0x00, 0x17, 0x0a, 0x48, 0x01,
+  0x17, 0x02, 0x32, 0x12, 0x09, 0x00, 0x1e, 0x17, 0x00, 0x17, 0x06, 0x09,
+  0x0f, 0x1b, 0x05, 0x00, 0x12, 0x17, 0x0b, 0x09, 0x0f, 0x21, 0x08, 0x00,
+  0x17, 0x0a, 0x18, 0x06, 0x12, 0x1e, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12,
+  0x12, 0x12, 0x1d, 0xbe, 0x00, 0x12, 0x12, 0x09, 0x00, 0x27, 0x00, 0x00,
+  0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+  0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+  0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+  0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+  0x00, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+  0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
+  0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
+  0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00,
+  0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00,
+  0x00, 0x2b, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+  0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00,
+  0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00,
+  0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00,
+  0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+  0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+  0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+  0x00, 0x2e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00,
+  0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+  0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00,
+  0x00, 0x31, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+  0x00, 0x32, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00,
+  0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00,
+  0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
+  0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
+  0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00,
+  0x00, 0x34, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+  0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+  0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+  0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+  0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+  0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+  0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+  0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+  0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+  0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00,
+  0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00,
+  0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+  0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+  0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00,
+  0x00, 0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+  0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,
+  0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00,
+  0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00,
+  0x00, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00,
+  0x00, 0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+  0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+  0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+  0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+  0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x7a, 0x6e, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x68, 0x61, 0x73,
+  0x68, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf0, 0x62, 0x6f, 0x1e, 0xf6, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x5f, 0x72, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0xa0, 0x33, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x63, 0x61, 0x70, 0x61, 0x63,
+  0x69, 0x74, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x2a, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x72, 0x61, 0x6e, 0x67, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0xd0, 0x77, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x65, 0x71, 0x75, 0x61, 0x6c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x65, 0x74,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0xf0, 0x75, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x83, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x17, 0x01, 0x2a,
+  0x01, 0x00, 0x00, 0x17, 0x03, 0x17, 0x02, 0x07, 0x15, 0x02, 0x00, 0x17,
+  0x02, 0x23, 0x01, 0x42, 0x1b, 0x64, 0x00, 0x41, 0x62, 0x00, 0x17, 0x00,
+  0x27, 0x03, 0x00, 0x17, 0x04, 0x17, 0x06, 0x03, 0x17, 0x02, 0x07, 0x31,
+  0x17, 0x07, 0x48, 0x00, 0x31, 0x17, 0x07, 0x48, 0x01, 0x31, 0x17, 0x07,
+  0x48, 0x02, 0x31, 0x17, 0x08, 0x09, 0x0f, 0x1b, 0x05, 0x00, 0x12, 0x17,
+  0x09, 0x09, 0x0f, 0x21, 0x05, 0x00, 0x09, 0x00, 0x1e, 0x28, 0x00, 0x17,
+  0x0a, 0x17, 0x03, 0x0f, 0x1b, 0x09, 0x00, 0x12, 0x17, 0x08, 0x17, 0x01,
+  0x2a, 0x04, 0x00, 0x01, 0x21, 0x14, 0x00, 0x17, 0x07, 0x48, 0x00, 0x09,
+  0x32, 0x12, 0x17, 0x07, 0x48, 0x01, 0x48, 0x01, 0x32, 0x12, 0x09, 0x00,
+  0x1e, 0x00, 0x00, 0x12, 0x12, 0x12, 0x12, 0x12, 0x1d, 0x64, 0x00, 0x12,
+  0x12, 0x09, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47,
+  0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48,
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48,
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x49,
+  0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49,
+  0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a,
+  0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a,
+  0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a,
+  0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a,
+  0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a,
+  0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b,
+  0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b,
+  0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b,
+  0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b,
+  0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c,
+  0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c,
+  0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d,
+  0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d,
+  0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f,
+  0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x50,
+  0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51,
+  0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52,
+  0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52,
+  0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53,
+  0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53,
+  0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53,
+  0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x55,
+  0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56,
+  0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56,
+  0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56,
+  0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56,
+  0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa0, 0x33, 0x6f, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x63,
+  0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x60, 0x7a, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x68, 0x61, 0x73, 0x68, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x20, 0x2a, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69,
+  0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd0, 0x77, 0x6e, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x65,
+  0x71, 0x75, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x90, 0x84, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0x27, 0x00, 0x00, 0x17, 0x00, 0x27, 0x01, 0x00, 0x01, 0x02, 0x00,
+  0x05, 0x0d, 0x21, 0x05, 0x00, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x17, 0x00,
+  0x27, 0x03, 0x00, 0x09, 0x17, 0x00, 0x27, 0x01, 0x00, 0x48, 0x08, 0x0d,
+  0x21, 0x08, 0x00, 0x48, 0x08, 0x18, 0x02, 0x12, 0x1e, 0x0b, 0x00, 0x17,
+  0x00, 0x27, 0x01, 0x00, 0x48, 0x02, 0x05, 0x18, 0x02, 0x12, 0x17, 0x00,
+  0x17, 0x02, 0x48, 0x03, 0x33, 0x02, 0x28, 0x03, 0x00, 0x12, 0x17, 0x00,
+  0x17, 0x02, 0x28, 0x01, 0x00, 0x12, 0x17, 0x00, 0x48, 0x00, 0x28, 0x00,
+  0x00, 0x12, 0x17, 0x01, 0x42, 0x1b, 0x2b, 0x00, 0x41, 0x29, 0x00, 0x17,
+  0x04, 0x48, 0x00, 0x31, 0x09, 0x0f, 0x0c, 0x21, 0x19, 0x00, 0x17, 0x00,
+  0x17, 0x04, 0x48, 0x00, 0x31, 0x17, 0x04, 0x48, 0x01, 0x31, 0x17, 0x04,
+  0x48, 0x02, 0x31, 0x2a, 0x04, 0x00, 0x03, 0x12, 0x1e, 0x00, 0x00, 0x12,
+  0x1d, 0x2b, 0x00, 0x12, 0x12, 0x09, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x59,
+  0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5a,
+  0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b,
+  0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5c,
+  0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5d,
+  0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e,
+  0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e,
+  0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e,
+  0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5f,
+  0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5f,
+  0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60,
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61,
+  0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61,
+  0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61,
+  0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x61,
+  0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63,
+  0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63,
+  0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63,
+  0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
+  0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x65,
+  0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x65,
+  0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x65,
+  0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67,
+  0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67,
+  0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67,
+  0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69,
+  0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a,
+  0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a,
+  0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x6b,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70,
+  0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xa0, 0x33, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8,
+  0x3f, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63,
+  0x6b, 0x69, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x62, 0x6f,
+  0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+  0x00, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x72, 0x65, 0x73, 0x69, 0x7a,
+  0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0xa0, 0x85, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0x95, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x23,
+  0x00, 0x17, 0x02, 0x17, 0x01, 0x33, 0x01, 0x28, 0x01, 0x00, 0x12, 0x17,
+  0x02, 0x00, 0x09, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+  0x73, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa0, 0x85, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50,
+  0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x77, 0x69, 0x74, 0x68, 0x5f,
+  0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xd0, 0x97, 0x6f,
+  0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x00,
+  0x17, 0x01, 0x27, 0x00, 0x00, 0x48, 0x00, 0x0f, 0x21, 0x15, 0x00, 0x17,
+  0x00, 0x48, 0x00, 0x28, 0x01, 0x00, 0x12, 0x17, 0x00, 0x48, 0x08, 0x33,
+  0x01, 0x28, 0x02, 0x00, 0x12, 0x1e, 0x13, 0x00, 0x17, 0x00, 0x17, 0x01,
+  0x27, 0x00, 0x00, 0x28, 0x01, 0x00, 0x12, 0x17, 0x00, 0x17, 0x01, 0x28,
+  0x02, 0x00, 0x12, 0x17, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x77, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00,
+  0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00,
+  0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00,
+  0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00,
+  0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x7e, 0x00,
+  0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x50, 0x76, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a,
+  0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61,
+  0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x9c, 0x6f, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00,
+  0x00, 0x17, 0x00, 0x27, 0x01, 0x00, 0x17, 0x00, 0x27, 0x02, 0x00, 0x4b,
+  0x02, 0x00, 0x09, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+  0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+  0x82, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xa0, 0x2a, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x5f, 0x69, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e,
+  0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69,
+  0x7a, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x69,
+  0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb0, 0x9d, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x17,
+  0x01, 0x17, 0x00, 0x27, 0x00, 0x00, 0x0d, 0x0c, 0x21, 0x1d, 0x00, 0x15,
+  0x01, 0x00, 0x15, 0x02, 0x00, 0x01, 0x03, 0x00, 0x17, 0x01, 0x48, 0x00,
+  0x17, 0x00, 0x27, 0x00, 0x00, 0x48, 0x01, 0x04, 0x23, 0x04, 0x23, 0x01,
+  0x45, 0x1e, 0x00, 0x00, 0x17, 0x00, 0x27, 0x04, 0x00, 0x17, 0x01, 0x31,
+  0x00, 0x09, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86,
+  0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x87,
+  0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x89,
+  0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x50, 0x9b, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x64, 0x65,
+  0x78, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20,
+  0x9c, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x66, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x9f, 0x6f,
+  0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00,
+  0x00, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x23, 0x20, 0x69, 0x73, 0x20,
+  0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64,
+  0x20, 0x5b, 0x23, 0x2c, 0x20, 0x23, 0x5d, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xf0, 0xa0, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+  0x00, 0x00, 0x00, 0x17, 0x01, 0x17, 0x00, 0x27, 0x00, 0x00, 0x0d, 0x0c,
+  0x21, 0x1d, 0x00, 0x15, 0x01, 0x00, 0x15, 0x02, 0x00, 0x01, 0x03, 0x00,
+  0x17, 0x01, 0x48, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x48, 0x01, 0x04,
+  0x23, 0x04, 0x23, 0x01, 0x45, 0x1e, 0x00, 0x00, 0x17, 0x00, 0x27, 0x04,
+  0x00, 0x17, 0x01, 0x17, 0x02, 0x32, 0x12, 0x09, 0x00, 0x8c, 0x00, 0x00,
+  0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00,
+  0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00,
+  0x00, 0x8d, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00,
+  0x00, 0x8e, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00,
+  0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a,
+  0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x9b, 0x6f, 0x1e, 0xf6, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x49, 0x6e,
+  0x64, 0x65, 0x78, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x20, 0x9c, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x66, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb0,
+  0xa0, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d,
+  0x00, 0x00, 0x00, 0x63, 0x61, 0x6e, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20,
+  0x61, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6e, 0x20,
+  0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x5b, 0x23, 0x2c, 0x20, 0x23, 0x5d,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63,
+  0x6b, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x73, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0xa6, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00,
+  0x00, 0x27, 0x01, 0x00, 0x17, 0x00, 0x27, 0x02, 0x00, 0x0f, 0x21, 0x3f,
+  0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x48, 0x02, 0x17, 0x02, 0x27, 0x01,
+  0x00, 0x05, 0x17, 0x03, 0x33, 0x01, 0x15, 0x03, 0x00, 0x17, 0x02, 0x17,
+  0x04, 0x48, 0x00, 0x48, 0x00, 0x17, 0x02, 0x27, 0x01, 0x00, 0x2a, 0x04,
+  0x00, 0x05, 0x12, 0x17, 0x04, 0x17, 0x02, 0x27, 0x01, 0x00, 0x17, 0x01,
+  0x32, 0x12, 0x17, 0x00, 0x17, 0x04, 0x28, 0x00, 0x00, 0x12, 0x12, 0x12,
+  0x12, 0x1e, 0x0e, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x17, 0x00, 0x27,
+  0x02, 0x00, 0x17, 0x01, 0x32, 0x12, 0x17, 0x00, 0x2e, 0x27, 0x02, 0x00,
+  0x48, 0x01, 0x03, 0x28, 0x02, 0x00, 0x12, 0x09, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00,
+  0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00,
+  0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00,
+  0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00,
+  0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00,
+  0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00,
+  0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00,
+  0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00,
+  0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00,
+  0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+  0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+  0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+  0x00, 0x99, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00,
+  0x00, 0x9a, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00,
+  0x00, 0x9a, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+  0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+  0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+  0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+  0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+  0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+  0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+  0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+  0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00,
+  0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f,
+  0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x62, 0x61, 0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x50, 0x76, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0xa8, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x72, 0x72,
+  0x61, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0xa8, 0x6f, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x63,
+  0x6f, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0xad, 0x6f, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x17, 0x02,
+  0x48, 0x00, 0x0d, 0x1c, 0x09, 0x00, 0x12, 0x17, 0x02, 0x17, 0x00, 0x27,
+  0x00, 0x00, 0x0e, 0x21, 0x1a, 0x00, 0x15, 0x01, 0x00, 0x15, 0x02, 0x00,
+  0x01, 0x03, 0x00, 0x17, 0x02, 0x48, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00,
+  0x23, 0x04, 0x23, 0x01, 0x45, 0x1e, 0x00, 0x00, 0x17, 0x00, 0x27, 0x04,
+  0x00, 0x17, 0x03, 0x27, 0x05, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x0f,
+  0x21, 0x4e, 0x00, 0x48, 0x02, 0x17, 0x03, 0x27, 0x05, 0x00, 0x05, 0x17,
+  0x04, 0x33, 0x01, 0x15, 0x06, 0x00, 0x17, 0x03, 0x17, 0x05, 0x48, 0x00,
+  0x48, 0x00, 0x17, 0x02, 0x2a, 0x07, 0x00, 0x05, 0x12, 0x15, 0x06, 0x00,
+  0x17, 0x03, 0x17, 0x05, 0x17, 0x02, 0x17, 0x02, 0x48, 0x01, 0x03, 0x17,
+  0x03, 0x27, 0x05, 0x00, 0x17, 0x02, 0x04, 0x2a, 0x07, 0x00, 0x05, 0x12,
+  0x17, 0x05, 0x17, 0x02, 0x17, 0x01, 0x32, 0x12, 0x17, 0x00, 0x17, 0x05,
+  0x28, 0x04, 0x00, 0x12, 0x12, 0x12, 0x1e, 0x3b, 0x00, 0x17, 0x02, 0x17,
+  0x00, 0x27, 0x00, 0x00, 0x0f, 0x0c, 0x21, 0x27, 0x00, 0x17, 0x00, 0x27,
+  0x00, 0x00, 0x17, 0x02, 0x04, 0x15, 0x06, 0x00, 0x17, 0x00, 0x27, 0x04,
+  0x00, 0x17, 0x00, 0x27, 0x04, 0x00, 0x17, 0x02, 0x17, 0x02, 0x48, 0x01,
+  0x03, 0x17, 0x04, 0x2a, 0x07, 0x00, 0x05, 0x12, 0x12, 0x1e, 0x00, 0x00,
+  0x17, 0x03, 0x17, 0x02, 0x17, 0x01, 0x32, 0x12, 0x17, 0x00, 0x2e, 0x27,
+  0x00, 0x00, 0x48, 0x01, 0x03, 0x28, 0x00, 0x00, 0x12, 0x09, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa1,
+  0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xa2,
+  0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3,
+  0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4,
+  0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa5,
+  0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5,
+  0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5,
+  0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5,
+  0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5,
+  0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6,
+  0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6,
+  0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa6,
+  0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa7,
+  0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa8,
+  0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa9,
+  0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa,
+  0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa,
+  0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa,
+  0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab,
+  0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab,
+  0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xac,
+  0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xac,
+  0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad,
+  0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad,
+  0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad,
+  0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad,
+  0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xae,
+  0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xae,
+  0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xae,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaf,
+  0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xb0,
+  0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xb1,
+  0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xb1,
+  0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xb1,
+  0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3,
+  0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3,
+  0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3,
+  0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3,
+  0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb4,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70,
+  0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x50, 0x9b, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x45, 0x72, 0x72,
+  0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x9c, 0x6e, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0xa0, 0xb0, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x63, 0x61, 0x6e,
+  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x61, 0x64, 0x64, 0x20, 0x74, 0x6f,
+  0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6e, 0x20, 0x72, 0x61,
+  0x6e, 0x67, 0x65, 0x20, 0x5b, 0x23, 0x2c, 0x20, 0x23, 0x5d, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b, 0x69,
+  0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x76, 0x6e, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0xa8,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x80, 0xa8, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xc0, 0xbe, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x48, 0x00, 0x0f, 0x21,
+  0x0c, 0x00, 0x15, 0x01, 0x00, 0x01, 0x02, 0x00, 0x23, 0x01, 0x45, 0x1e,
+  0x00, 0x00, 0x17, 0x00, 0x27, 0x03, 0x00, 0x17, 0x00, 0x2e, 0x27, 0x00,
+  0x00, 0x48, 0x01, 0x04, 0x28, 0x00, 0x00, 0x31, 0x00, 0x09, 0x00, 0xb7,
+  0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7,
+  0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7,
+  0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7,
+  0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8,
+  0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8,
+  0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8,
+  0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xb9,
+  0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xbb,
+  0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x60, 0xbf, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x44, 0x61,
+  0x74, 0x61, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xc0, 0xbf, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x70,
+  0x6f, 0x70, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6e, 0x20, 0x65,
+  0x6d, 0x70, 0x74, 0x79, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61, 0x63, 0x6b,
+  0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x70, 0x6f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x50, 0x94, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00,
+  0x48, 0x00, 0x0f, 0x21, 0x0c, 0x00, 0x15, 0x01, 0x00, 0x01, 0x02, 0x00,
+  0x23, 0x01, 0x45, 0x1e, 0x00, 0x00, 0x17, 0x01, 0x48, 0x00, 0x0d, 0x1c,
+  0x0a, 0x00, 0x12, 0x17, 0x01, 0x17, 0x00, 0x27, 0x00, 0x00, 0x0d, 0x0c,
+  0x21, 0x1d, 0x00, 0x15, 0x03, 0x00, 0x15, 0x04, 0x00, 0x01, 0x05, 0x00,
+  0x17, 0x01, 0x48, 0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x48, 0x01, 0x04,
+  0x23, 0x04, 0x23, 0x01, 0x45, 0x1e, 0x00, 0x00, 0x17, 0x00, 0x27, 0x06,
+  0x00, 0x17, 0x00, 0x27, 0x00, 0x00, 0x48, 0x01, 0x04, 0x17, 0x01, 0x04,
+  0x17, 0x02, 0x17, 0x01, 0x31, 0x15, 0x07, 0x00, 0x17, 0x02, 0x17, 0x02,
+  0x17, 0x01, 0x48, 0x01, 0x03, 0x17, 0x01, 0x17, 0x03, 0x2a, 0x08, 0x00,
+  0x05, 0x12, 0x17, 0x00, 0x2e, 0x27, 0x00, 0x00, 0x48, 0x01, 0x04, 0x28,
+  0x00, 0x00, 0x12, 0x17, 0x04, 0x00, 0x09, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+  0xbe, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+  0xbf, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+  0xc1, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0xc3, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0xc4, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0xc6, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
+  0xc8, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00,
+  0xc9, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x70, 0x36, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x73, 0x69, 0x7a, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x60, 0xbf, 0x6f,
+  0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00,
+  0x00, 0x4e, 0x6f, 0x44, 0x61, 0x74, 0x61, 0x45, 0x72, 0x72, 0x6f, 0x72,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0xd0, 0xc1, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x63, 0x61, 0x6e,
+  0x6e, 0x6f, 0x74, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79,
+  0x20, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x50, 0x9b, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x45, 0x72, 0x72,
+  0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x9c, 0x6e, 0x1e, 0xf6,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x66,
+  0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0xc6, 0x6f, 0x1e, 0xf6, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x63, 0x61, 0x6e,
+  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65,
+  0x20, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6e,
+  0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x5b, 0x23, 0x2c, 0x20, 0x23,
+  0x5d, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x34, 0x6f, 0x1e, 0xf6, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x61,
+  0x63, 0x6b, 0x69, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0xa8,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x00, 0x00, 0x41, 0x72, 0x72, 0x61, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x80, 0xa8, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x60, 0xbf, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x44, 0x61, 0x74, 0x61, 0x45, 0x72,
+  0x72, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0xe0, 0xc4, 0x6f, 0x1e,
+  0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0x45, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0xce,
+  0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0x17, 0x00, 0x01, 0x01, 0x00, 0x17, 0x01, 0x03, 0x28, 0x00, 0x00,
+  0x12, 0x17, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+  0xcf, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+  0xd0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+  0xa0, 0x7a, 0x6e, 0x1e, 0xf6, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0x00, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x20, 0xcf, 0x6f, 0x1e, 0xf6, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x44, 0x61,
+  0x74, 0x61, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x3a, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x69, 0x74, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00
+};
+unsigned int liblox_data_structure_len = 11003;
@@ -69,6 +69,7 @@ static void print_result_with_color(InterpretResult result) {
             printf("== repl exited ==\n");
             break;
         case INTERPRET_ERROR_CAUGHT:
+        case INTERPRET_ARM_WAIT_POINT:
         case INTERPRET_0:
             IMPLEMENTATION_ERROR("????");
             break;
@@ -223,7 +224,7 @@ static void main_disassemble_bytecode(const char *code_path) {
 int main(int argc, char *const argv[]) {
 
     init_VM();
-    char *options = "dsc:bhnv";
+    char *options = "dsc:bhnvm:";
     int op;
     while ((op = getopt(argc, argv, options)) != -1) {
         switch (op) {
@@ -247,6 +248,13 @@ int main(int argc, char *const argv[]) {
             case 'n': // do not load libraries
                 LOAD_LIB = false;
                 break;
+            case 'm': // max call depth
+                vm.frame_limit = atoi(optarg);
+                if (vm.frame_limit <= 0) {
+                    printf("The max call depth should be a positive integer\n");
+                    exit(1);
+                }
+                break;
             case 'h':
             default:
                 printf("Options: \n");
@@ -254,7 +262,8 @@ int main(int argc, char *const argv[]) {
                 printf("-d: trace the execution\n");
                 printf("-c path/to/output: compile and write the result to the specified path\n");
                 printf("-b: treat the given file as bytecode\n");
-                printf("-v: treat the given file as bytecode and disassemble it (but don't run it)");
+                printf("-v: treat the given file as bytecode and disassemble it (but don't run it)\n");
+                printf("-m depth: the max call depth before a stack overflow (default: "XSTR(FRAME_LIMIT_DEFAULT)")\n");
                 exit(1);
         }
     }
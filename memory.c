@@ -43,6 +43,7 @@ static void mark_roots() {
 
     // mark global
     table_mark(&vm.builtin);
+    table_mark_values(&vm.format_templates);
     mark_object((Object *) repl_module);
 
     // mark existing frames。否则调用中的函数可能会被回收
@@ -59,6 +60,10 @@ static void mark_roots() {
     mark_object((Object *) HASH);
     mark_object((Object *) MESSAGE);
     mark_object((Object *) POSITION);
+    for (int i = 0; i <= UINT8_MAX; ++i) {
+        mark_object((Object *) vm.single_byte_strings[i]);
+    }
+    mark_object((Object *) vm.empty_array);
 
 //    // mark open upvalues ? 暂时无法理解。这些值是open的，意味着它们仍然在作用域内，要么是在stack上，要么是在globals中。我认为没必要额外标记
 //    UpValueObject *curr = vm.open_upvalues;
@@ -79,6 +84,8 @@ static void blacken_object(Object *object) {
 #endif
     switch (object->type) {
         case OBJ_STRING:
+            mark_object((Object *) ((String *) object)->parent);
+            break;
         case OBJ_NATIVE:
             break;
         case OBJ_UPVALUE: {
@@ -89,6 +96,7 @@ static void blacken_object(Object *object) {
         case OBJ_FUNCTION: {
             LoxFunction *function = (LoxFunction *) object;
             mark_object((Object *) function->name);
+            mark_object((Object *) function->cached_closure);
             for (int i = 0; i < function->chunk.constants.count; ++i) {
                 mark_value(function->chunk.constants.values[i]);
             }
@@ -151,7 +159,7 @@ static void blacken_object(Object *object) {
         }
         case OBJ_MAP: {
             Map *map = (Map *) object;
-            for (int i = 0; i < map->capacity; ++i) {
+            for (int i = 0; i < map_length(map); ++i) {
                 mark_value(map->backing[i].key);
                 mark_value(map->backing[i].value);
             }
@@ -203,6 +211,7 @@ static void gc() {
     mark_roots();
     trace();
     table_delete_unreachable(&vm.string_table);
+    table_delete_unreachable(&vm.format_templates);
     sweep();
 
 }
@@ -270,7 +279,9 @@ void free_object(Object *object) {
     switch (object->type) {
         case OBJ_STRING: {
             String *str = (String *) object;
-            FREE_ARRAY(char, str->chars, str->length + 1);
+            if (str->parent == NULL) {
+                FREE_ARRAY(char, str->chars, str->length + 1);
+            }
             re_allocate(object, sizeof(String), 0);
             break;
         }
@@ -333,7 +344,8 @@ void free_object(Object *object) {
         }
         case OBJ_MAP: {
             Map *map = (Map *) object;
-            FREE_ARRAY(MapEntry, map->backing, map->capacity);
+            FREE_ARRAY(MapEntry, map->backing, MAP_USABLE(map->capacity));
+            FREE_ARRAY(int, map->index, map->capacity);
             re_allocate(map, sizeof(Map), 0);
             break;
         }
@@ -8,12 +8,11 @@
 #include "liblox_iter.h"
 #include "liblox_data_structure.h"
 #include "vm.h"
+#include "memory.h"
 #include "stdlib.h"
 #include "string.h"
 #include "time.h"
 
-#define FNV_PRIME 16777619
-#define FNV_OFFSET_BASIS 2166136261
 
 Class *array_class;
 Class *string_class;
@@ -126,17 +125,50 @@ static Value native_value_of(int count, Value *values) {
 Value native_backtrace(int count, Value *value) {
     (void ) count;
     (void ) value;
-    int total_len = 0;
-    char **css = malloc(sizeof(char *) * vm.frame_count);
-    int *lens = malloc(sizeof(int) * vm.frame_count);
+    Value snapshot = backtrace_snapshot();
+    stack_push(snapshot); // prevent gc
+    Value result = backtrace_format(snapshot);
+    stack_pop();
+    return result;
+}
 
-    for (int i = vm.frame_count - 1; i >= 0; i--) {
+/**
+ * 记录当前调用栈的快照：一个NativeBacktrace，values[0]是一个数组，依次储存每个栈帧的closure和正在执行的指令的位置。
+ * 格式化的开销较大，因此只在需要时由backtrace_format()完成
+ */
+Value backtrace_snapshot() {
+    Array *frames = new_array(vm.frame_count * 2, false);
+    for (int i = 0; i < vm.frame_count; ++i) {
         CallFrame *frame = vm.frames + i;
-        LoxFunction *function = frame->closure->function;
-        size_t index = frame->PC - frame->closure->function->chunk.code - 1;
-        int line = function->chunk.lines[index];
-        char *name = value_to_chars(ref_value((Object *) frame->closure), NULL);
-        char *module_name = value_to_chars(ref_value((Object *)frame->closure->module_of_define), NULL);
+        frames->values[2 * i] = ref_value((Object *) frame->closure);
+        frames->values[2 * i + 1] = int_value((int) (frame->PC - frame->closure->function->chunk.code - 1));
+    }
+    stack_push(ref_value((Object *) frames)); // prevent gc
+    NativeObject *snapshot = new_native_object(NativeBacktrace, 1);
+    snapshot->values[0] = stack_pop();
+    return ref_value((Object *) snapshot);
+}
+
+bool is_backtrace_snapshot(Value value) {
+    return is_ref_of(value, OBJ_NATIVE_OBJECT) && as_native_object(value)->native_type == NativeBacktrace;
+}
+
+/**
+ * 将backtrace_snapshot()产生的快照格式化为String，最内层的栈帧在最前。
+ * 调用者需保证snapshot不会被gc
+ */
+Value backtrace_format(Value snapshot) {
+    Array *frames = as_array(as_native_object(snapshot)->values[0]);
+    int frame_count = frames->length / 2;
+    int total_len = 0;
+    char **css = malloc(sizeof(char *) * frame_count);
+    int *lens = malloc(sizeof(int) * frame_count);
+
+    for (int i = frame_count - 1; i >= 0; i--) {
+        Closure *closure = as_closure(frames->values[2 * i]);
+        int line = closure->function->chunk.lines[as_int(frames->values[2 * i + 1])];
+        char *name = value_to_chars(ref_value((Object *) closure), NULL);
+        char *module_name = value_to_chars(ref_value((Object *) closure->module_of_define), NULL);
         lens[i] = asprintf(css + i, "at [line %d] in %s of %s\n", line, name, module_name);
         free(name);
         free(module_name);
@@ -144,7 +176,7 @@ Value native_backtrace(int count, Value *value) {
     }
     char *result = malloc(total_len + 1);
     char *curr = result;
-    for (int i = vm.frame_count - 1; i >= 0; i --) {
+    for (int i = frame_count - 1; i >= 0; i --) {
         memcpy(curr, css[i], lens[i]);
         curr += lens[i];
         free(css[i]);
@@ -152,7 +184,7 @@ Value native_backtrace(int count, Value *value) {
     result[total_len] = '\0';
     free(css);
     free(lens);
-    String *str = string_copy(result, total_len);
+    String *str = string_allocate(result, total_len);
     return ref_value((Object *) str);
 }
 
@@ -253,6 +285,43 @@ static Value native_map_method_delete(int count, Value *values) {
     return stack_pop();
 }
 
+static Value native_map_method_has(int count, Value *values) {
+    (void ) count;
+    assert_ref_type(values[-1], OBJ_MAP, "Map"); // [map, key]
+    return bool_value(map_lookup(as_map(values[-1])) != NULL);
+}
+
+static Value native_map_method_get_or(int count, Value *values) {
+    (void ) count;
+    assert_ref_type(values[-1], OBJ_MAP, "Map"); // [map, key, default]
+    Value default_value = values[1]; // map_lookup()调用hash()时栈可能被移动，之后values不再有效
+    stack_push(values[0]);
+    MapEntry *entry = map_lookup(as_map(values[-1]));
+    stack_pop();
+    return entry == NULL ? default_value : entry->value;
+}
+
+/**
+ * 创建一个空的map，并预先分配足以容纳values[0]个entry的空间
+ */
+static Value native_map_with_capacity(int count, Value *values) {
+    (void ) count;
+    assert_value_type(values[0], VAL_INT, "Int");
+    int capacity = as_int(values[0]);
+    if (capacity < 0) {
+        throw_new_runtime_error(Error_ValueError, "ValueError: the capacity cannot be negative");
+    }
+    if (capacity > MAP_USABLE(MAP_CAPACITY_MAX)) {
+        throw_new_runtime_error(Error_ValueError, "ValueError: the capacity %d exceeds the limit %d", capacity,
+                                MAP_USABLE(MAP_CAPACITY_MAX));
+    }
+    Map *map = new_map();
+    stack_push(ref_value((Object *) map));
+    map_reserve(map, capacity);
+    stack_pop();
+    return ref_value((Object *) map);
+}
+
 /**
  * 类似于memcpy
  * @param values [src, dest, src_start_index, dest_start_index, len_to_copy]。
@@ -297,11 +366,18 @@ static Value native_read(int count, Value *values) {
     if (count > 0) {
         print_value(*values);
     }
-    size_t len;
-    char *line;
-    getline(&line, &len, stdin);
-    String *str = string_copy(line, len - 1); // NOLINT
-    free(line);
+    fflush(stdout); // 提示符和之前的输出必须在等待输入之前出现
+    size_t capacity = 0;
+    char *line = NULL;
+    ssize_t len = getline(&line, &capacity, stdin);
+    if (len < 0) {
+        free(line);
+        return ref_value((Object *) string_copy_uninterned("", 0));
+    }
+    if (len > 0 && line[len - 1] == '\n') {
+        line[--len] = '\0';
+    }
+    String *str = string_allocate(line, (int) len);
     return ref_value((Object *) str);
 }
 
@@ -309,66 +385,6 @@ static inline int max(int a, int b) {
     return a > b ? a : b;
 }
 
-static Value native_format(int count, Value *values) {
-    const char *format = as_string(*values)->chars;
-    static int capacity = 0;
-    static char *buf = NULL;
-    int pre = 0;
-    int curr = 0;
-    int buf_len = 0;
-    int curr_v = 0;
-
-    while (true) {
-        while (format[curr] != '\0' && format[curr] != '#') {
-            curr++;
-        }
-
-        int new_len = curr - pre;
-        // buf overflow checking
-        if (buf_len + new_len > capacity) {
-            capacity = max(2 * capacity, buf_len + new_len);
-            buf = realloc(buf, capacity); // NOLINT
-        }
-
-        memcpy(buf + buf_len, format + pre, new_len);
-        buf_len += new_len;
-        pre = curr;
-
-        if (format[curr] == '\0') {
-            if (curr_v != count - 1) {
-                free(buf);
-                throw_new_runtime_error(Error_ArgError, "ArgError: more arguments than placeholders");
-            }
-            break;
-        }
-
-        if (format[curr] == '#') {
-            if (curr_v == count - 1) {
-                free(buf);
-                throw_new_runtime_error(Error_ArgError, "ArgError: more placeholders than arguments");
-            }
-
-            Value v = values[curr_v + 1];
-            int v_chars_len;
-            char *v_chars = value_to_chars(v, &v_chars_len);
-
-            if (v_chars_len + buf_len > capacity) {
-                capacity = max(2 * capacity, v_chars_len + buf_len);
-                buf = realloc(buf, capacity); // NOLINT
-            }
-            memcpy(buf + buf_len, v_chars, v_chars_len);
-            buf_len += v_chars_len;
-            curr++;
-            pre = curr;
-            curr_v++;
-            free(v_chars);
-        }
-    }
-
-    String *string = string_copy(buf, buf_len);
-    return ref_value((Object *) string);
-}
-
 static Value native_clock(int count, Value *value) {
     (void) count;
     (void) value;
@@ -387,10 +403,16 @@ static Value native_int(int count, Value *value) {
         default:
             if (is_ref_of(*value, OBJ_STRING)) {
                 String *str = as_string(*value);
+                // 切片不以'\0'结尾，需要先复制
+                char *chars = str->parent == NULL ? str->chars : strndup(str->chars, str->length);
                 char *end;
-                int result = strtol(str->chars, &end, 10); // NOLINT
-                if (end == str->chars) {
-                    throw_new_runtime_error(Error_ValueError, "ValueError: not a valid int: %s", str->chars);
+                int result = strtol(chars, &end, 10); // NOLINT
+                bool valid = end != chars;
+                if (chars != str->chars) {
+                    free(chars);
+                }
+                if (!valid) {
+                    throw_new_runtime_error(Error_ValueError, "ValueError: not a valid int: %.*s", str->length, str->chars);
                 }
                 return int_value(result);
             }
@@ -412,10 +434,15 @@ static Value native_float(int count, Value *value) {
         default:
             if (is_ref_of(v, OBJ_STRING)) {
                 String *str = as_string(v);
+                char *chars = str->parent == NULL ? str->chars : strndup(str->chars, str->length);
                 char *end;
-                double result = strtod(str->chars, &end);
-                if (end == str->chars) {
-                    throw_new_runtime_error(Error_ValueError, "ValueError: not a valid float: %s", str->chars);
+                double result = strtod(chars, &end);
+                bool valid = end != chars;
+                if (chars != str->chars) {
+                    free(chars);
+                }
+                if (!valid) {
+                    throw_new_runtime_error(Error_ValueError, "ValueError: not a valid float: %.*s", str->length, str->chars);
                 }
                 return float_value(result);
             }
@@ -436,6 +463,16 @@ static Value native_help(int count, Value *value) {
     return nil_value();
 }
 
+/**
+ * 依次输出所有参数，不添加分隔符和换行符
+ */
+static Value native_write(int count, Value *values) {
+    for (int i = 0; i < count; ++i) {
+        print_value(values[i]);
+    }
+    return nil_value();
+}
+
 static Value native_exit(int count, Value *value) {
     (void ) count;
     (void ) value;
@@ -452,26 +489,119 @@ static Value native_rand(int count, Value *value) {
     return int_value(as_int(a) + rand() % as_int(b)); // NOLINT(*-msc50-cpp)
 }
 
+/**
+ * 逐段写入的字符缓冲区，最终由string_allocate()占据，作为String的chars
+ */
+typedef struct CharBuffer {
+    char *chars;
+    int length;
+    int capacity;
+} CharBuffer;
+
+static void init_char_buffer(CharBuffer *buffer, int capacity) {
+    buffer->capacity = capacity < 16 ? 16 : capacity;
+    buffer->chars = malloc(buffer->capacity);
+    buffer->length = 0;
+}
+
+static void char_buffer_append(CharBuffer *buffer, const char *chars, int length) {
+    if (buffer->length + length + 1 > buffer->capacity) {
+        buffer->capacity = max(buffer->capacity * 2, buffer->length + length + 1);
+        buffer->chars = realloc(buffer->chars, buffer->capacity);
+    }
+    memcpy(buffer->chars + buffer->length, chars, length);
+    buffer->length += length;
+}
+
+/**
+ * 写入value的字符串表达。数字等直接格式化，不分配临时的字符串
+ */
+static void char_buffer_append_value(CharBuffer *buffer, Value value) {
+    char temp[VALUE_BUFFER_SIZE];
+    int len;
+    bool allocated;
+    const char *chars = value_chars(value, temp, &len, &allocated);
+    char_buffer_append(buffer, chars, len);
+    if (allocated) {
+        free((char *) chars);
+    }
+}
+
+static String *char_buffer_to_string(CharBuffer *buffer) {
+    buffer->chars[buffer->length] = '\0';
+    return string_allocate(buffer->chars, buffer->length);
+}
+
+/**
+ * 扫描format，记录所有占位符#的位置。结果为Array，[0]为#的个数，之后为每个#的下标
+ */
+static Array *parse_format_template(String *format) {
+    int placeholder_count = 0;
+    for (int i = 0; i < format->length; ++i) {
+        placeholder_count += format->chars[i] == '#';
+    }
+    Array *template = new_array(placeholder_count + 1, false);
+    template->values[0] = int_value(placeholder_count);
+    int curr = 1;
+    for (int i = 0; i < format->length; ++i) {
+        if (format->chars[i] == '#') {
+            template->values[curr++] = int_value(i);
+        }
+    }
+    return template;
+}
+
+/**
+ * format字符串通常是常量（interned），其模板只解析一次并缓存在vm.format_templates中。
+ * 渲染前先检查参数个数，然后按预估的长度一次性分配缓冲区，直接写入，最后由String占据该缓冲区
+ */
+static Value native_format(int count, Value *values) {
+    String *format = as_string(*values);
+    Value cached;
+    Array *template;
+    if (format->is_interned && table_get(&vm.format_templates, format, &cached)) {
+        template = as_array(cached);
+    } else {
+        template = parse_format_template(format);
+        if (format->is_interned) {
+            stack_push(ref_value((Object *) template)); // prevent gc
+            table_set(&vm.format_templates, format, ref_value((Object *) template));
+            stack_pop();
+        }
+    }
+    int placeholder_count = as_int(template->values[0]);
+    if (placeholder_count != count - 1) {
+        throw_new_runtime_error(Error_ArgError, placeholder_count < count - 1
+                                                ? "ArgError: more arguments than placeholders"
+                                                : "ArgError: more placeholders than arguments");
+    }
+
+    int estimated_len = format->length - placeholder_count;
+    for (int i = 1; i < count; ++i) {
+        estimated_len += is_ref_of(values[i], OBJ_STRING) ? as_string(values[i])->length : VALUE_BUFFER_SIZE;
+    }
+    stack_push(ref_value((Object *) template)); // prevent gc
+    CharBuffer buffer;
+    init_char_buffer(&buffer, estimated_len + 1);
+    int pre = 0;
+    for (int i = 0; i < placeholder_count; ++i) {
+        int position = as_int(template->values[i + 1]);
+        char_buffer_append(&buffer, format->chars + pre, position - pre);
+        char_buffer_append_value(&buffer, values[i + 1]);
+        pre = position + 1;
+    }
+    char_buffer_append(&buffer, format->chars + pre, format->length - pre);
+    stack_pop();
+    return ref_value((Object *) char_buffer_to_string(&buffer));
+}
+
 static Value native_string_combine(int count, Value *values) {
-    int total_len = 0;
-    char **css = malloc(sizeof(char *) * count);
-    int *lens = malloc(sizeof(int ) * count);
+    CharBuffer buffer;
+    init_char_buffer(&buffer, count * 8);
     for (int i = 0; i < count; ++i) {
-        css[i] = value_to_chars(values[i], lens + i);
-        total_len += lens[i];
+        char_buffer_append_value(&buffer, values[i]);
     }
-    char *result= malloc(total_len + 1);
-    char *curr = result;
-    for (int i = 0; i < count; ++i) {
-        memcpy(curr, css[i], lens[i]);
-        curr += lens[i];
-        free(css[i]);
-    }
-    result[total_len] = '\0';
-    free(lens);
-    free(css);
-    String *str = string_allocate(result, total_len);
-    return ref_value((Object *) str);
+    return ref_value((Object *) char_buffer_to_string(&buffer));
 }
 
 static Value native_string_combine_array(int count, Value *value) {
@@ -482,6 +612,21 @@ static Value native_string_combine_array(int count, Value *value) {
     return native_string_combine(array->length, array->values);
 }
 
+/**
+ * @param values [array, n]: 拼接array中前n个值的字符串表达
+ */
+static Value native_string_combine_n(int count, Value *values) {
+    (void ) count;
+    assert_ref_type(values[0], OBJ_ARRAY, "array");
+    assert_value_type(values[1], VAL_INT, "int");
+    Array *array = as_array(values[0]);
+    int n = as_int(values[1]);
+    if (n < 0 || n > array->length) {
+        throw_new_runtime_error(Error_IndexError, "IndexError: %d is out of bound: [%d, %d]", n, 0, array->length);
+    }
+    return native_string_combine(n, array->values);
+}
+
 static Value native_string_join(int count, Value *values) {
     // 0: delimiter, 1: prefix, 2: suffix, 3: array
     (void ) count;
@@ -499,7 +644,7 @@ static Value native_string_join(int count, Value *values) {
     Array *array = as_array(v3);
     int array_len = array->length;
 
-    int total_len = prefix->length + suffix->length + delimiter->length * (array_len - 1);
+    int total_len = prefix->length + suffix->length + (array_len > 0 ? delimiter->length * (array_len - 1) : 0);
 
     for (int i = 0; i < array_len; ++i) {
         Value v = array->values[i];
@@ -566,10 +711,10 @@ static Value native_string_method_substring(int count, Value *value) {
     String *str = as_string(value[-1]);
     int start = as_int(value[0]);
     int end = as_int(value[1]);
-    if (start < 0 || end > str->length) {
+    if (start < 0 || end > str->length || start > end) {
         throw_new_runtime_error(Error_ValueError, "the range: [%d, %d] is invalid", start, end);
     }
-    String *result = string_copy(str->chars + start, (end - start));
+    String *result = string_slice(str, start, end - start);
     return ref_value_cast(result);
 }
 
@@ -590,33 +735,137 @@ static Value native_value_join(int count, Value *values) {
     Array *array = as_array(v3);
     int array_len = array->length;
 
-    int total_len = prefix->length + suffix->length + delimiter->length * (array_len - 1);
-    char **css = malloc(sizeof(char *) * array_len);
-    int *lens = malloc(sizeof(int ) * array_len);
-
+    CharBuffer buffer;
+    init_char_buffer(&buffer, prefix->length + suffix->length + array_len * (delimiter->length + 8));
+    char_buffer_append(&buffer, prefix->chars, prefix->length);
     for (int i = 0; i < array_len; ++i) {
-        css[i] = value_to_chars(array->values[i], lens + i);
-        total_len += lens[i];
+        if (i != 0) {
+            char_buffer_append(&buffer, delimiter->chars, delimiter->length);
+        }
+        char_buffer_append_value(&buffer, array->values[i]);
     }
-    char *result= malloc(total_len + 1);
+    char_buffer_append(&buffer, suffix->chars, suffix->length);
+    return ref_value((Object *) char_buffer_to_string(&buffer));
+}
+
+/**
+ * 检查[receiver, arg]都是String，返回arg
+ */
+static String *string_method_arg(Value *values) {
+    assert_ref_type(values[-1], OBJ_STRING, "String");
+    assert_ref_type(values[0], OBJ_STRING, "String");
+    return as_string(values[0]);
+}
+
+/**
+ * 检查[receiver, arg]都是String，并且arg不为空，返回arg
+ */
+static String *string_method_non_empty_arg(Value *values) {
+    String *arg = string_method_arg(values);
+    if (arg->length == 0) {
+        throw_new_runtime_error(Error_ValueError, "ValueError: the string argument cannot be empty");
+    }
+    return arg;
+}
+
+static Value native_string_method_find(int count, Value *values) {
+    (void ) count;
+    String *needle = string_method_arg(values);
+    return int_value(string_find(as_string(values[-1]), needle, 0));
+}
+
+static Value native_string_method_rfind(int count, Value *values) {
+    (void ) count;
+    String *needle = string_method_arg(values);
+    return int_value(string_rfind(as_string(values[-1]), needle));
+}
+
+static Value native_string_method_contains(int count, Value *values) {
+    (void ) count;
+    String *needle = string_method_arg(values);
+    return bool_value(string_find(as_string(values[-1]), needle, 0) != -1);
+}
+
+static Value native_string_method_starts_with(int count, Value *values) {
+    (void ) count;
+    String *prefix = string_method_arg(values);
+    String *str = as_string(values[-1]);
+    return bool_value(prefix->length <= str->length && memcmp(str->chars, prefix->chars, prefix->length) == 0);
+}
+
+static Value native_string_method_ends_with(int count, Value *values) {
+    (void ) count;
+    String *suffix = string_method_arg(values);
+    String *str = as_string(values[-1]);
+    return bool_value(suffix->length <= str->length &&
+                      memcmp(str->chars + str->length - suffix->length, suffix->chars, suffix->length) == 0);
+}
+
+/**
+ * @return 不重叠的needle在str中出现的次数
+ */
+static int string_count(String *str, String *needle) {
+    int count = 0;
+    for (int i = string_find(str, needle, 0); i != -1; i = string_find(str, needle, i + needle->length)) {
+        count++;
+    }
+    return count;
+}
+
+static Value native_string_method_count(int count, Value *values) {
+    (void ) count;
+    String *needle = string_method_non_empty_arg(values);
+    return int_value(string_count(as_string(values[-1]), needle));
+}
+
+/**
+ * @param values [str, separator]
+ * @return 以separator分割str得到的数组，元素是str的切片
+ */
+static Value native_string_method_split(int count, Value *values) {
+    (void ) count;
+    String *separator = string_method_non_empty_arg(values);
+    String *str = as_string(values[-1]);
+    Array *parts = new_array(string_count(str, separator) + 1, true);
+    stack_push(ref_value((Object *) parts)); // prevent gc
+    int start = 0;
+    for (int i = 0; i < parts->length - 1; ++i) {
+        int end = string_find(str, separator, start);
+        parts->values[i] = ref_value((Object *) string_slice(str, start, end - start));
+        start = end + separator->length;
+    }
+    parts->values[parts->length - 1] = ref_value((Object *) string_slice(str, start, str->length - start));
+    return stack_pop();
+}
+
+/**
+ * @param values [str, old, new]
+ * @return 将str中所有不重叠的old替换为new后的String
+ */
+static Value native_string_method_replace_all(int count, Value *values) {
+    (void ) count;
+    String *old = string_method_non_empty_arg(values);
+    assert_ref_type(values[1], OBJ_STRING, "String");
+    String *new = as_string(values[1]);
+    String *str = as_string(values[-1]);
+    int occurrences = string_count(str, old);
+    if (occurrences == 0) {
+        return values[-1];
+    }
+    int new_len = str->length + occurrences * (new->length - old->length);
+    char *result = malloc(new_len + 1);
     char *curr = result;
-    memcpy(curr, prefix->chars, prefix->length);
-    curr += prefix->length;
-    for (int i = 0; i < array_len; ++i) {
-        memcpy(curr, css[i], lens[i]);
-        curr += lens[i];
-        free(css[i]);
-        if (i != array_len - 1) {
-            memcpy(curr, delimiter->chars, delimiter->length);
-            curr += delimiter->length;
-        }
+    int start = 0;
+    for (int i = string_find(str, old, 0); i != -1; i = string_find(str, old, start)) {
+        memcpy(curr, str->chars + start, i - start);
+        curr += i - start;
+        memcpy(curr, new->chars, new->length);
+        curr += new->length;
+        start = i + old->length;
     }
-    memcpy(curr, suffix->chars, suffix->length);
-    result[total_len] = '\0';
-    free(lens);
-    free(css);
-    String *str = string_allocate(result, total_len);
-    return ref_value((Object *) str);
+    memcpy(curr, str->chars + start, str->length - start);
+    result[new_len] = '\0';
+    return ref_value((Object *) string_allocate(result, new_len));
 }
 
 static Value native_string_method_char_at(int count, Value *value) {
@@ -628,17 +877,34 @@ static Value native_string_method_char_at(int count, Value *value) {
     if (index < 0 || index >= string->length) {
         throw_new_runtime_error(Error_IndexError, "IndexError: index %d is out of bound: [%d, %d]", index, 0, string->length - 1);
     }
-    String *c = string_copy(string->chars+index, 1);
+    String *c = vm.single_byte_strings[(uint8_t) string->chars[index]];
     return ref_value((Object *) c);
 }
 
+/**
+ * range(end), range(start, end), range(start, end, step)。
+ * 参数直接从栈上读取，不经过Lox的包装函数，因此不需要填充可选参数
+ */
 static Value native_range(int count, Value *value) {
+    if (count < 1 || count > 3) {
+        throw_new_runtime_error(Error_ArgError, "ArgError: range expects 1 to 3 arguments, but got %d", count);
+    }
+    // range(end)与range(end, nil, step)从0开始
+    bool from_zero = count == 1 || is_nil(value[1]);
+    Value start_value = from_zero ? int_value(0) : value[0];
+    Value end_value = from_zero ? value[0] : value[1];
+    Value step_value = count == 3 ? value[2] : int_value(1);
+    assert_value_type(start_value, VAL_INT, "Int");
+    assert_value_type(end_value, VAL_INT, "Int");
+    assert_value_type(step_value, VAL_INT, "Int");
+    int start = as_int(start_value);
+    int end = as_int(end_value);
+    int step = as_int(step_value);
     // curr, limit, step
-    (void ) count;
     NativeObject *native_object = new_native_object(NativeRangeIter, 3);
-    native_object->values[2] = value[2]; // step
-    native_object->values[0] = int_value(as_int(value[0]) - as_int(value[2])); // curr
-    native_object->values[1] = int_value(as_int(value[1]) - as_int(value[2])); // limit
+    native_object->values[2] = int_value(step);
+    native_object->values[0] = int_value(start - step);
+    native_object->values[1] = int_value(end - step);
     return ref_value((Object *) native_object);
 }
 
@@ -653,48 +919,42 @@ static Value native_array_iter(int count, Value *value) {
     return ref_value((Object *) nativeObject);
 }
 
+static Value native_string_iter(int count, Value *value) {
+    (void ) count;
+    // curr, string
+    assert_ref_type(*value, OBJ_STRING, "string");
+    NativeObject *nativeObject = new_native_object(NativeStringIter, 2);
+    nativeObject->values[0] = int_value(0);
+    nativeObject->values[1] = *value;
+    return ref_value((Object *) nativeObject);
+}
+
 uint32_t value_hash(Value given) {
-    uint32_t hash = FNV_OFFSET_BASIS;
     switch(given.type) {
-        case VAL_INT: { // int
-            int value = as_int(given);
-            const unsigned char* bytes = (const unsigned char*)&value;
-            for (size_t i = 0; i < sizeof(int); i++) {
-                hash ^= bytes[i];
-                hash *= FNV_PRIME;
-            }
-            return hash;
+        case VAL_INT: {
+            return u64_hash((uint64_t) (int64_t) as_int(given));
         }
-        case VAL_FLOAT: { // double
+        case VAL_FLOAT: {
             double value = as_float(given);
-            const unsigned char* bytes = (const unsigned char*)&value;
-            for (size_t i = 0; i < sizeof(double); i++) {
-                hash ^= bytes[i];
-                hash *= FNV_PRIME;
+            if (value == 0) {
+                value = 0; // -0.0 == 0.0，两者的hash必须相同
             }
-            return hash;
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return u64_hash(bits);
         }
-        case VAL_BOOL: { // bool
-            bool value = as_bool(given);
-            hash ^= value ? 1 : 0;
-            hash *= FNV_PRIME;
-            return hash;
+        case VAL_BOOL: {
+            return u64_hash(as_bool(given) ? 1 : 0);
         }
         case VAL_NIL: {
             return 0;
         }
-        case VAL_REF: { // pointer
+        case VAL_REF: {
             if (is_ref_of(given, OBJ_STRING)) {
                 String *string = as_string(given);
-                return string->hash;
+                return string_hash(string);
             } else {
-                uintptr_t ptr = (uintptr_t) as_ref(given);
-                const unsigned char* bytes = (const unsigned char*)&ptr;
-                for (size_t i = 0; i < sizeof(void*); i++) {
-                    hash ^= bytes[i];
-                    hash *= FNV_PRIME;
-                }
-                return hash;
+                return u64_hash((uint64_t) (uintptr_t) as_ref(given));
             }
         }
         default:
@@ -712,32 +972,7 @@ static Value native_method_general_hash(int count, Value *given) {
 
 Value native_method_value_equal(int count, Value *values) {
     (void ) count;
-    Value a = values[-1];
-    Value b = values[0];
-    if (a.type != b.type) {
-        return bool_value(false);
-    }
-    bool result;
-    switch (a.type) {
-        case VAL_BOOL:
-            result = as_bool(a) == as_bool(b);
-            break;
-        case VAL_INT:
-            result = as_int(a) == as_int(b);
-            break;
-        case VAL_FLOAT:
-            result =  as_float(a) == as_float(b);
-            break;
-        case VAL_NIL:
-        case VAL_ABSENCE:
-            result = true;
-            break;
-        case VAL_REF: {
-            result = as_ref(a) == as_ref(b);
-            break;
-        }
-    }
-    return bool_value(result);
+    return bool_value(value_equal(values[-1], values[0]));
 }
 
 Value native_map_iter(int count, Value *value) {
@@ -757,13 +992,16 @@ void init_vm_native() {
     define_native("rand", native_rand, 2);
     define_native("f", native_format, -1);
     define_native("read", native_read, -1);
+    define_native("write", native_write, -1);
     define_native("type", native_type, 1);
     define_native("native_string_combine_array", native_string_combine_array, 1);
+    define_native("native_string_combine_n", native_string_combine_n, 2);
     define_native("native_value_join", native_value_join, 4);
     define_native("native_string_join", native_string_join, 4);
-    define_native("native_range", native_range, 3);
+    define_native("range", native_range, -1);
     define_native("native_array_iter", native_array_iter, 2);
     define_native("native_map_iter", native_map_iter, 1);
+    define_native("native_string_iter", native_string_iter, 1);
     define_native("backtrace", native_backtrace, 0);
     define_native("value_of", native_value_of, 2);
     define_native("is_object", native_is_object, 1);
@@ -785,6 +1023,10 @@ void init_static_strings() {
     HASH = auto_length_string_copy("hash");
     MESSAGE = auto_length_string_copy("message");
     POSITION = auto_length_string_copy("position");
+    for (int i = 0; i <= UINT8_MAX; ++i) {
+        char c = (char) i;
+        vm.single_byte_strings[i] = string_copy(&c, 1);
+    }
 }
 
 /**
@@ -884,9 +1126,22 @@ void load_libraries() {
     add_native_method(string_class, "substring", native_string_method_substring, 2);
     add_native_method(string_class, "replace", native_string_method_replace, 3);
     add_native_method(string_class, "char_at", native_string_method_char_at, 1);
+    add_native_method(string_class, "find", native_string_method_find, 1);
+    add_native_method(string_class, "rfind", native_string_method_rfind, 1);
+    add_native_method(string_class, "contains", native_string_method_contains, 1);
+    add_native_method(string_class, "count", native_string_method_count, 1);
+    add_native_method(string_class, "split", native_string_method_split, 1);
+    add_native_method(string_class, "starts_with", native_string_method_starts_with, 1);
+    add_native_method(string_class, "ends_with", native_string_method_ends_with, 1);
+    add_native_method(string_class, "replace_all", native_string_method_replace_all, 2);
     add_native_method(map_class, "delete", native_map_method_delete, 1);
+    add_native_method(map_class, "has", native_map_method_has, 1);
+    add_native_method(map_class, "contains", native_map_method_has, 1);
+    add_native_method(map_class, "get_or", native_map_method_get_or, 2);
     add_native_method(class_class, "subclass_of", native_class_method_subclass_of, 1);
     add_native_class_static_function(array_class, "copy", native_array_copy, 5);
+    add_native_class_static_function(map_class, "with_capacity", native_map_with_capacity, 1);
+    add_native_class_static_function(string_class, "concat", native_string_combine, -1);
 
     add_native_method(int_class, "hash", native_method_general_hash, 0);
     add_native_method(nil_class, "hash", native_method_general_hash, 0);
@@ -66,6 +66,9 @@ void init_static_strings();
 bool is_subclass(Class *one, Class *two);
 bool multi_value_of(int count, Value *values);
 Value native_backtrace(int count, Value *value);
+Value backtrace_snapshot();
+bool is_backtrace_snapshot(Value value);
+Value backtrace_format(Value snapshot);
 void new_error(ErrorType type, const char *message);
 void throw_new_runtime_error(ErrorType type, const char *format, ...);
 void throw_user_level_runtime_error(ErrorType type, const char *format, ...);
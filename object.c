@@ -5,8 +5,12 @@
 #include "memory.h"
 #include "vm.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /**
- * 使用指定的 src 产生一个 String。
+ * 使用指定的 src 产生一个interned String。用于标识符、常量等需要作为Table的key的字符串。
  * 如果同值的string已存在，那么直接返回那个对象。
  * 否则，分配新的内存空间以复制那些字符，并创建一个string。
  * 原char*不会被引用，也不会被修改。
@@ -22,6 +26,7 @@ String *string_copy(const char *src, int length) {
     }
 
     String *str = (String *) allocate_object(sizeof(String), OBJ_STRING);
+    str->parent = NULL; // 下面分配chars时可能触发gc，此时str已在stack上，会被blacken_object()访问
     stack_push(ref_value((Object *) str));
     char *chars = ALLOCATE(char, length + 1);
     memcpy(chars, src, length);
@@ -29,6 +34,8 @@ String *string_copy(const char *src, int length) {
     str->chars = chars;
     str->length = length;
     str->hash = hash;
+    str->is_hashed = true;
+    str->is_interned = true;
     table_add_new(&vm.string_table, str, nil_value(), true, false);
     stack_pop();
     return str;
@@ -40,47 +47,192 @@ String *auto_length_string_copy(const char *name) {
 }
 
 /**
- * 如果同值的String不存在，使用（占据）给定的 char* 来产生一个 String。
- * 如果同值的String已经存在，那么不产生新的，而是直接返回旧有的，并free给定的chars
+ * 使用（占据）给定的 char* 来产生一个String。运行时产生的字符串大多是临时的，
+ * 因此不会被intern，hash也只在第一次需要时才计算。需要作为Table的key时，使用string_intern()
  * */
 String *string_allocate(char *chars, int length) {
 
-    uint32_t hash = chars_hash(chars, length);
+    // chars由malloc分配，没有被计入allocated_size。此后它将通过FREE_ARRAY释放，因此在这里计入
+    vm.allocated_size += length + 1;
 
-    String *interned = table_find_string(&vm.string_table, chars, length, hash);
+    String *str = (String *) allocate_object(sizeof(String), OBJ_STRING);
+    str->chars = chars;
+    str->length = length;
+    str->hash = 0;
+    str->is_hashed = false;
+    str->is_interned = false;
+    str->parent = NULL;
+    return str;
+}
 
+/**
+ * @return str中[start, start + length)的部分。长度为0或1的结果是预先intern的String，
+ * 其他情况下产生一个引用原缓冲区的切片，不复制字符。调用者需保证范围合法，并且str不会被gc
+ */
+String *string_slice(String *str, int start, int length) {
+    if (length == 1) {
+        return vm.single_byte_strings[(uint8_t) str->chars[start]];
+    }
+    if (length == 0) {
+        return string_copy("", 0);
+    }
+    if (start == 0 && length == str->length) {
+        return str;
+    }
+    String *root = str->parent == NULL ? str : str->parent;
+    char *chars = str->chars + start;
+    String *slice = (String *) allocate_object(sizeof(String), OBJ_STRING);
+    slice->chars = chars;
+    slice->length = length;
+    slice->hash = 0;
+    slice->is_hashed = false;
+    slice->is_interned = false;
+    slice->parent = root;
+    return slice;
+}
+
+/**
+ * 复制src，产生一个不被intern的String
+ */
+String *string_copy_uninterned(const char *src, int length) {
+    char *chars = malloc(length + 1);
+    memcpy(chars, src, length);
+    chars[length] = '\0';
+    return string_allocate(chars, length);
+}
+
+/**
+ * @return str的hash。对于没有被intern的String，在第一次调用时计算并缓存
+ */
+uint32_t string_hash(String *str) {
+    if (!str->is_hashed) {
+        str->hash = chars_hash(str->chars, str->length);
+        str->is_hashed = true;
+    }
+    return str->hash;
+}
+
+/**
+ * @return 与str同值的interned String。如果不存在，str本身成为interned String
+ */
+String *string_intern(String *str) {
+    if (str->is_interned) {
+        return str;
+    }
+    uint32_t hash = string_hash(str);
+    String *interned = table_find_string(&vm.string_table, str->chars, str->length, hash);
     if (interned != NULL) {
-        FREE_ARRAY(char, chars, length + 1);
         return interned;
     }
+    stack_push(ref_value((Object *) str)); // prevent being gc
+    str->is_interned = true;
+    table_add_new(&vm.string_table, str, nil_value(), true, false); // this may cause gc
+    stack_pop();
+    return str;
+}
 
-    String *str = (String *) allocate_object(sizeof(String), OBJ_STRING);
+#if defined(__SSE2__)
 
-    stack_push(ref_value((Object *) str)); // prevent being gc
+/**
+ * 每次检查16个候选位置：只有首字节和末字节都与needle相同的位置才需要memcmp
+ */
+static int find_bytes(const char *hay, int hay_len, const char *needle, int needle_len, int from) {
+    int last = needle_len - 1;
+    int limit = hay_len - needle_len; // 最后一个候选位置
+    __m128i first_byte = _mm_set1_epi8(needle[0]);
+    __m128i last_byte = _mm_set1_epi8(needle[last]);
+    int i = from;
+    for (; i + 15 <= limit; i += 16) {
+        __m128i block_first = _mm_loadu_si128((const __m128i *) (hay + i));
+        __m128i block_last = _mm_loadu_si128((const __m128i *) (hay + i + last));
+        __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(block_first, first_byte), _mm_cmpeq_epi8(block_last, last_byte));
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(eq);
+        while (mask != 0) {
+            int offset = __builtin_ctz(mask);
+            if (memcmp(hay + i + offset + 1, needle + 1, needle_len - 1) == 0) {
+                return i + offset;
+            }
+            mask &= mask - 1;
+        }
+    }
+    for (; i <= limit; ++i) {
+        if (hay[i] == needle[0] && memcmp(hay + i + 1, needle + 1, needle_len - 1) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
 
-    str->object.type = OBJ_STRING;
-    str->chars = chars;
-    str->length = length;
-    str->hash = hash;
-    table_add_new(&vm.string_table, str, nil_value(), true, false); // this may cause gc
+#else
+
+static int find_bytes(const char *hay, int hay_len, const char *needle, int needle_len, int from) {
+    int limit = hay_len - needle_len;
+    int i = from;
+    while (i <= limit) {
+        // memchr通常已经由libc向量化
+        const char *candidate = memchr(hay + i, needle[0], limit - i + 1);
+        if (candidate == NULL) {
+            return -1;
+        }
+        i = (int) (candidate - hay);
+        if (memcmp(candidate + 1, needle + 1, needle_len - 1) == 0) {
+            return i;
+        }
+        i++;
+    }
+    return -1;
+}
 
-    stack_pop();
+#endif
 
-    return str;
+/**
+ * @return needle在str中从from开始第一次出现的位置。不存在时返回-1。空的needle总是在from处被找到
+ */
+int string_find(String *str, String *needle, int from) {
+    if (needle->length == 0) {
+        return from <= str->length ? from : -1;
+    }
+    if (from < 0 || needle->length > str->length - from) {
+        return -1;
+    }
+    return find_bytes(str->chars, str->length, needle->chars, needle->length, from);
+}
+
+/**
+ * @return needle在str中最后一次出现的位置。不存在时返回-1
+ */
+int string_rfind(String *str, String *needle) {
+    if (needle->length == 0) {
+        return str->length;
+    }
+    for (int i = str->length - needle->length; i >= 0; --i) {
+        if (str->chars[i] == needle->chars[0] && memcmp(str->chars + i, needle->chars, needle->length) == 0) {
+            return i;
+        }
+    }
+    return -1;
 }
 
 /**
  * 将a 和 b 的字符串表达拼接在一起，产生一个 String
  * */
 String *string_concat(Value a, Value b) {
+    // String直接使用其chars，数字等写入栈上的缓冲区，只有其他对象才需要分配临时的字符串
+    char a_buffer[VALUE_BUFFER_SIZE], b_buffer[VALUE_BUFFER_SIZE];
     int len_a, len_b;
-    char *a_str = value_to_chars(a, &len_a);
-    char *b_str = value_to_chars(b, &len_b);
+    bool a_allocated, b_allocated;
+    const char *a_str = value_chars(a, a_buffer, &len_a, &a_allocated);
+    const char *b_str = value_chars(b, b_buffer, &len_b, &b_allocated);
     char *buffer = malloc(len_a + len_b + 1);
     memcpy(buffer, a_str, len_a);
-    memcpy(buffer + len_a, b_str, len_b + 1);
-    free(a_str);
-    free(b_str);
+    memcpy(buffer + len_a, b_str, len_b);
+    buffer[len_a + len_b] = '\0';
+    if (a_allocated) {
+        free((char *) a_str);
+    }
+    if (b_allocated) {
+        free((char *) b_str);
+    }
     return string_allocate(buffer, len_a + len_b);
 }
 
@@ -100,13 +252,76 @@ Object *allocate_object(size_t size, ObjectType type) {
     return obj;
 }
 
+#define HASH_P0 0xa0761d6478bd642full
+#define HASH_P1 0xe7037ed1a0b428dbull
+
+/**
+ * 64位乘法，将128位结果的高低两半异或在一起
+ */
+static inline uint64_t hash_mix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t) a * b;
+    return (uint64_t) r ^ (uint64_t) (r >> 64);
+#else
+    uint64_t a_hi = a >> 32, a_lo = (uint32_t) a, b_hi = b >> 32, b_lo = (uint32_t) b;
+    uint64_t hh = a_hi * b_hi, hl = a_hi * b_lo, lh = a_lo * b_hi, ll = a_lo * b_lo;
+    uint64_t mid = (ll >> 32) + (uint32_t) hl + (uint32_t) lh;
+    uint64_t lo = (mid << 32) | (uint32_t) ll;
+    uint64_t hi = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+    return lo ^ hi;
+#endif
+}
+
+static inline uint64_t read_u64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t read_u32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * 一次处理16字节的字符串hash（wyhash的结构）。以vm.hash_seed为种子，因此每个进程的hash都不同
+ */
 uint32_t chars_hash(const char *key, int length) {
-    uint32_t hash = 2166136261u;
-    for (int i = 0; i < length; i++) {
-        hash ^= (uint8_t) key[i];
-        hash *= 16777619;
+    const uint8_t *p = (const uint8_t *) key;
+    size_t len = (size_t) length;
+    uint64_t seed = vm.hash_seed;
+    uint64_t a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            // 用可能重叠的4个4字节读取覆盖全部字节
+            size_t mid = (len >> 3) << 2;
+            a = (read_u32(p) << 32) | read_u32(p + mid);
+            b = (read_u32(p + len - 4) << 32) | read_u32(p + len - 4 - mid);
+        } else if (len > 0) {
+            a = ((uint64_t) p[0] << 16) | ((uint64_t) p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        while (i > 16) {
+            seed = hash_mix(read_u64(p) ^ HASH_P1, read_u64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = read_u64(p + i - 16);
+        b = read_u64(p + i - 8);
     }
-    return hash;
+    return (uint32_t) hash_mix(HASH_P1 ^ len, hash_mix(a ^ HASH_P1, b ^ seed));
+}
+
+/**
+ * 用于Int、Float、指针等定长的值：一次乘法混合
+ */
+uint32_t u64_hash(uint64_t value) {
+    return (uint32_t) hash_mix(value ^ vm.hash_seed, HASH_P0);
 }
 
 
@@ -116,11 +331,25 @@ LoxFunction *new_function(FunctionType type) {
     function->fixed_arg_count = 0;
     function->optional_arg_count = 0;
     function->var_arg = false;
+    function->exact_arity = 0;
+    function->max_stack = 1;
     function->type = type;
     function->upvalue_count = 0;
+    function->cached_closure = NULL;
     return function;
 }
 
+/**
+ * 参数列表确定后，据此计算exact_arity
+ */
+void settle_call_shape(LoxFunction *function) {
+    if (function->optional_arg_count == 0 && !function->var_arg) {
+        function->exact_arity = function->fixed_arg_count;
+    } else {
+        function->exact_arity = -1;
+    }
+}
+
 Closure *new_closure(LoxFunction *function) {
     Closure *closure = (Closure *) allocate_object(sizeof(Closure), OBJ_CLOSURE);
 
@@ -222,6 +451,7 @@ NativeObject *new_native_object(NativeObjectType type, int value_used) {
 Map *new_map() {
     Map *map = (Map *) allocate_object(sizeof(Map), OBJ_MAP);
     map->backing = NULL;
+    map->index = NULL;
     map->capacity = 0;
     map->active_count = 0;
     map->del_count = 0;
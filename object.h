@@ -26,7 +26,9 @@ typedef enum {
 typedef enum NativeObjectType {
     NativeRangeIter,
     NativeArrayIter,
-    NativeMapIter
+    NativeMapIter,
+    NativeStringIter,
+    NativeBacktrace
 } NativeObjectType;
 
 typedef struct Object{
@@ -55,11 +57,19 @@ typedef enum FunctionType {
     TYPE_INITIALIZER,
 } FunctionType;
 
+/**
+ * 只有interned String才在vm.string_table中，同值的interned String具有相同的地址。
+ * 其他String的hash在第一次需要时才计算，应通过string_hash()获取。
+ * parent不为NULL时，String是parent的一个切片：chars指向parent的缓冲区，不拥有它，也不以'\0'结尾
+ */
 typedef struct String{
     Object object;
     int length;
     char *chars;
     uint32_t hash;
+    bool is_hashed;
+    bool is_interned;
+    struct String *parent;
 } String;
 
 typedef struct LoxFunction {
@@ -71,6 +81,9 @@ typedef struct LoxFunction {
     int fixed_arg_count; // 固定参数的数量。
     short optional_arg_count; // 可选参数的数量
     bool var_arg; // 是否接受可变数量的参数。arity=3, var_arg=true意味着至少三个参数，实际调用时会将所有额外参数作为一个数组传入
+    int max_stack; // 栈帧中（相对于FP）同时存在的值的最大数量，由编译器计算
+    int exact_arity; // 没有可选参数和可变参数时，等于fixed_arg_count：参数数量与之相同的调用无需任何调整。否则为-1
+    struct Closure *cached_closure; // 当upvalue_count为0时，所有由该函数产生的closure都是相同的，因此只需创建一次
 } LoxFunction;
 
 typedef struct UpValue {
@@ -114,12 +127,17 @@ typedef struct MapEntry {
     int hash;
 } MapEntry;
 
+/**
+ * backing按照插入顺序紧密地储存entry，被删除的entry的key为absence，在重建时被移除。
+ * index是稀疏的哈希索引，每个位置储存backing中entry的下标，或者为MAP_SLOT_EMPTY，MAP_SLOT_DELETED
+ */
 typedef struct Map {
     Object object;
     int active_count;
-    int del_count;
-    int capacity;
+    int del_count; // backing中被删除的entry的数量
+    int capacity; // index的长度，总为2的幂。backing的长度为MAP_USABLE(capacity)
     MapEntry *backing;
+    int *index;
 } Map;
 
 typedef Value (*NativeImplementation)(int count, Value *values);
@@ -158,18 +176,29 @@ typedef struct NativeMethod {
 #define as_map(v) ((Map *)(as_ref(v)) )
 #define as_native_method(v) ((NativeMethod *)as_ref(v) )
 
-#define map_empty_entry(entry) (is_absence((entry)->key) && is_absence((entry)->value))
-#define map_del_mark(entry) (is_absence((entry)->key) && is_nil((entry)->value))
-#define map_need_resize(map) (((map)->active_count + (map)->del_count + 1) >= (map)->capacity * 0.75)
+#define MAP_SLOT_EMPTY (-1)
+#define MAP_SLOT_DELETED (-2)
+#define MAP_USABLE(capacity) ((capacity) * 3 / 4)
+#define MAP_CAPACITY_MAX (1 << 28) // 更大的capacity会使MAP_USABLE()和容量的翻倍溢出int
+#define map_length(map) ((map)->active_count + (map)->del_count)
+#define map_need_resize(map) (map_length(map) >= MAP_USABLE((map)->capacity))
+#define map_need_shrink(map) ((map)->del_count > 0 && (map)->capacity > 8 && (map)->active_count < MAP_USABLE((map)->capacity) / 8)
 
 String *string_copy(const char *src, int length);
 String *auto_length_string_copy(const char *name);
 String *string_allocate(char *chars, int length);
+String *string_copy_uninterned(const char *src, int length);
+String *string_intern(String *str);
+String *string_slice(String *str, int start, int length);
+int string_find(String *str, String *needle, int from);
+int string_rfind(String *str, String *needle);
+uint32_t string_hash(String *str);
 String *string_concat(Value a, Value b);
 
 Object *allocate_object(size_t size, ObjectType type);
 
 LoxFunction *new_function(FunctionType type);
+void settle_call_shape(LoxFunction *function);
 NativeFunction *new_native(NativeImplementation impl, String *name, int arity);
 Closure *new_closure(LoxFunction *function);
 UpValue *new_upvalue(Value *position);
@@ -183,6 +212,7 @@ Map *new_map();
 NativeObject *new_native_object(NativeObjectType type, int num_used);
 NativeMethod *new_native_method(NativeFunction *fun, Value receiver);
 uint32_t chars_hash(const char *key, int length);
+uint32_t u64_hash(uint64_t value);
 
 
 #endif
\ No newline at end of file
@@ -3,36 +3,202 @@
 #include "memory.h"
 #include "string.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define GROUP_WIDTH 16
+#define CTRL_EMPTY ((int8_t) -128)
+#define CTRL_DELETED ((int8_t) -2)
+
 /**
- * 判断一个entry是否为“空”：key为null，值为nil
- * @return 是否为空
+ * 组内匹配的结果：第i位为1表示组内第i个control字节匹配
  */
-static inline bool empty_entry(Entry *entry) {
-    return entry->key == NULL && is_nil(entry->value);
+typedef uint32_t GroupMask;
+
+#if defined(__SSE2__)
+
+static inline GroupMask group_match(const int8_t *group, int8_t tag) {
+    __m128i ctrl = _mm_loadu_si128((const __m128i *) group);
+    return (GroupMask) _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag)));
+}
+
+static inline GroupMask group_match_empty_or_deleted(const int8_t *group) {
+    // 空位和删除标记的最高位都是1
+    return (GroupMask) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) group));
+}
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+
+static inline GroupMask neon_to_mask(uint8x16_t cmp) {
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t bits = vandq_u8(cmp, vld1q_u8(weights));
+    return (GroupMask) vaddv_u8(vget_low_u8(bits)) | (GroupMask) vaddv_u8(vget_high_u8(bits)) << 8;
+}
+
+static inline GroupMask group_match(const int8_t *group, int8_t tag) {
+    return neon_to_mask(vceqq_s8(vld1q_s8(group), vdupq_n_s8(tag)));
+}
+
+static inline GroupMask group_match_empty_or_deleted(const int8_t *group) {
+    return neon_to_mask(vcltzq_s8(vld1q_s8(group)));
+}
+
+#else
+
+static inline GroupMask group_match(const int8_t *group, int8_t tag) {
+    GroupMask mask = 0;
+    for (int i = 0; i < GROUP_WIDTH; ++i) {
+        mask |= (GroupMask) (group[i] == tag) << i;
+    }
+    return mask;
+}
+
+static inline GroupMask group_match_empty_or_deleted(const int8_t *group) {
+    GroupMask mask = 0;
+    for (int i = 0; i < GROUP_WIDTH; ++i) {
+        mask |= (GroupMask) (group[i] < 0) << i;
+    }
+    return mask;
 }
 
+#endif
+
+static inline GroupMask group_match_empty(const int8_t *group) {
+    return group_match(group, CTRL_EMPTY);
+}
 
 /**
- * del marker：如果key为NULL，值为bool，认为是一个del marker
- * @return 该entry是否是del marker
+ * hash的低7位保存在control中，其余的位用于选择起始的组
  */
-static inline bool del_mark(Entry *entry) {
-    return entry->key == NULL && is_bool(entry->value);
+static inline int8_t hash_tag(uint32_t hash) {
+    return (int8_t) (hash & 0x7f);
+}
+
+/**
+ * 组的数量总是2的幂，返回其减一的值，用于对组号取模
+ */
+static inline uint32_t group_mask(Table *table) {
+    return (uint32_t) (table->capacity - 1) / GROUP_WIDTH;
+}
+
+static inline int control_length(int capacity) {
+    return capacity < GROUP_WIDTH ? GROUP_WIDTH : capacity;
 }
 
 static inline bool need_resize(Table *table) {
     return table->count + 1 >= table->capacity * 0.75;
 }
 
+/**
+ * 存活的entry远少于容量时（通常是大量删除之后），table应当缩小
+ */
+static inline bool need_shrink(Table *table) {
+    return table->capacity > 8 && (table->count - table->deleted + 1) < table->capacity * 0.75 / 8;
+}
+
+/**
+ * @return 容纳live个entry，并且在此基础上还能插入同样多的entry而不需要扩容的最小容量
+ */
+static int capacity_for(int live) {
+    int capacity = 8;
+    while ((live + 1) * 2 > capacity * 0.75) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * 按照探查顺序寻找key
+ * @param empty_index 如果不为NULL且key不存在，则在此储存探查终止处的第一个空位
+ * @return key所在的索引。如果不存在，返回-1
+ */
+static inline int probe_key(Table *table, String *key, int *empty_index) {
+    int8_t tag = hash_tag(key->hash);
+    uint32_t mask = group_mask(table);
+    // 负载因子保证了table中总有空位，因此探查总会终止
+    for (uint32_t group = (key->hash >> 7) & mask;; group = (group + 1) & mask) {
+        int base = (int) group * GROUP_WIDTH;
+        const int8_t *ctrl = table->control + base;
+        for (GroupMask match = group_match(ctrl, tag); match != 0; match &= match - 1) {
+            int index = base + __builtin_ctz(match);
+            if (table->backing[index].key == key) {
+                return index;
+            }
+        }
+        GroupMask empty = group_match_empty(ctrl);
+        if (empty != 0) {
+            if (empty_index != NULL) {
+                *empty_index = base + __builtin_ctz(empty);
+            }
+            return -1;
+        }
+    }
+}
+
+/**
+ * 沿着探查顺序寻找第一个空位或删除标记。调用者需保证key不存在于table中
+ */
+static int probe_free_slot(Table *table, uint32_t hash) {
+    uint32_t mask = group_mask(table);
+    for (uint32_t group = (hash >> 7) & mask;; group = (group + 1) & mask) {
+        int base = (int) group * GROUP_WIDTH;
+        GroupMask free = group_match_empty_or_deleted(table->control + base);
+        if (free != 0) {
+            return base + __builtin_ctz(free);
+        }
+    }
+}
+
+static void fill_slot(Table *table, int index, String *key, Value value, bool is_public, bool is_const) {
+    if (table->control[index] == CTRL_EMPTY) {
+        table->count++;
+    } else {
+        table->deleted--;
+    }
+    table->control[index] = hash_tag(key->hash);
+    Entry *entry = table->backing + index;
+    entry->key = key;
+    entry->value = value;
+    entry->is_public = is_public;
+    entry->is_const = is_const;
+}
+
+/**
+ * 删除index处的entry。如果所在的组中仍有空位，说明没有任何探查越过了该组，可以直接标记为空位；
+ * 否则标记为删除
+ */
+static void erase_slot(Table *table, int index) {
+    Entry *entry = table->backing + index;
+    entry->key = NULL;
+    if (group_match_empty(table->control + index / GROUP_WIDTH * GROUP_WIDTH) != 0) {
+        table->control[index] = CTRL_EMPTY;
+        entry->value = nil_value();
+        table->count--;
+    } else {
+        table->control[index] = CTRL_DELETED;
+        entry->value = bool_value(true);
+        table->deleted++;
+    }
+}
+
+/**
+ * 按照存活的entry数量重新分配table，同时清除所有删除标记。
+ * 删除标记较多时容量可能不变甚至缩小
+ */
 static void table_resize(Table *table) {
     int old_capacity = table->capacity;
-    int new_capacity = old_capacity < 8 ? 8 : table->capacity * 2;
+    int new_capacity = capacity_for(table->count - table->deleted);
 #ifdef DEBUG_LOG_GC_ALLOCATE
     printf("table resize. old capacity: %d, new: %d\n", old_capacity, new_capacity);
 #endif
 
     Entry *old_backing = table->backing;
+    int8_t *old_control = table->control;
     Entry *new_backing = ALLOCATE(Entry, new_capacity);
+    int8_t *new_control = ALLOCATE(int8_t, control_length(new_capacity));
 
     for (int i = 0; i < new_capacity; ++i) {
         new_backing[i].key = NULL;
@@ -40,19 +206,26 @@ static void table_resize(Table *table) {
         new_backing[i].is_public = false;
         new_backing[i].is_const = false;
     }
+    memset(new_control, (uint8_t) CTRL_EMPTY, control_length(new_capacity));
 
     table->capacity = new_capacity;
-    table->backing =new_backing;
+    table->backing = new_backing;
+    table->control = new_control;
     table->count = 0;
+    table->deleted = 0;
 
     for (int i = 0; i < old_capacity; ++i) {
         Entry *entry = old_backing + i;
         if (entry->key != NULL) {
-            table_add_new(table, entry->key, entry->value, entry->is_public, entry->is_const);
+            int index = probe_free_slot(table, entry->key->hash);
+            fill_slot(table, index, entry->key, entry->value, entry->is_public, entry->is_const);
         }
     }
 
     FREE_ARRAY(Entry, old_backing, old_capacity);
+    if (old_control != NULL) {
+        FREE_ARRAY(int8_t, old_control, control_length(old_capacity));
+    }
 }
 
 /**
@@ -60,32 +233,29 @@ static void table_resize(Table *table) {
  * 如果存在，但不是满足条件，返回NULL
  */
 Entry *table_find_entry(Table *table, String *key, bool public_only, bool mutable_only) {
-    int hash = key->hash;
-    for (int i = 0; i < table->capacity; ++i) {
-        int curr = MODULO(hash + i, table->capacity);
-        Entry *entry = table->backing + curr;
-        if (empty_entry(entry)) {
-            return entry;
-        }
-        if (entry->key == key) {
-            if (public_only && !entry->is_public) {
-                return NULL;
-            }
-            if (mutable_only && entry->is_const) {
-                return NULL;
-            }
-            return entry;
-        }
+    if (table->capacity == 0) {
+        return NULL;
     }
-    IMPLEMENTATION_ERROR("table_find_entry() does not find empty spot and returns NULL");
-    return NULL;
+    int empty_index;
+    int index = probe_key(table, key, &empty_index);
+    if (index == -1) {
+        return table->backing + empty_index;
+    }
+    Entry *entry = table->backing + index;
+    if (public_only && !entry->is_public) {
+        return NULL;
+    }
+    if (mutable_only && entry->is_const) {
+        return NULL;
+    }
+    return entry;
 }
 
 inline bool table_has(Table *table, String *key) {
     if (table->count == 0) {
         return false;
     }
-    return !empty_entry(table_find_entry(table, key, false, false));
+    return probe_key(table, key, NULL) != -1;
 }
 
 
@@ -94,17 +264,15 @@ inline bool table_has(Table *table, String *key) {
  * @return 是否存在该key
  */
 bool table_get(Table *table, String *key, Value *value) {
-//    return table_conditional_get(table, key, value, false, false);
     if (table->count == 0) {
         return false;
     }
-    Entry *entry = table_find_entry(table, key, false, false);
-    if (entry == NULL || empty_entry(entry)) {
+    int index = probe_key(table, key, NULL);
+    if (index == -1) {
         return false;
-    } else {
-        *value = entry->value;
-        return true;
     }
+    *value = table->backing[index].value;
+    return true;
 }
 
 bool table_conditional_get(Table *table, String *key, Value *value, bool public_only, bool mutable_only) {
@@ -112,7 +280,7 @@ bool table_conditional_get(Table *table, String *key, Value *value, bool public_
         return false;
     }
     Entry *entry = table_find_entry(table, key, public_only, mutable_only);
-    if (entry == NULL || empty_entry(entry)) {
+    if (entry == NULL || entry->key == NULL) {
         return false;
     } else {
         *value = entry->value;
@@ -126,42 +294,20 @@ bool table_conditional_get(Table *table, String *key, Value *value, bool public_
  * 该函数可能导致gc
  */
 bool table_set(Table *table, String *key, Value value) {
-
-    if (need_resize(table)) {
+    if (need_resize(table) || need_shrink(table)) {
         table_resize(table);
     }
-    Entry *mark = NULL;
-    int hash = key->hash;
-    for (int i = 0; i < table->capacity; ++i) {
-        int curr = MODULO(hash + i, table->capacity);
-        Entry *entry = table->backing + curr;
-        if (empty_entry(entry)) {
-            if (mark == NULL) {
-                entry->key = key;
-                entry->value = value;
-                entry->is_const = false;
-                entry->is_public = false;
-                table->count++;
-            } else {
-                mark->key = key;
-                mark->value = value;
-                entry->is_const = false;
-                entry->is_public = false;
-            }
-            return true;
-        } else if(entry->key == key) {
-            if (entry->is_const) {
-                return false;
-            } else {
-                entry->value = value;
-                return true;
-            }
-        } else if (mark == NULL && del_mark(entry)) {
-            mark = entry;
+    int index = probe_key(table, key, NULL);
+    if (index != -1) {
+        Entry *entry = table->backing + index;
+        if (entry->is_const) {
+            return false;
         }
+        entry->value = value;
+        return true;
     }
-    IMPLEMENTATION_ERROR("table_set() does not find empty spot");
-    return false;
+    fill_slot(table, probe_free_slot(table, key->hash), key, value, false, false);
+    return true;
 }
 
 /**
@@ -169,30 +315,24 @@ bool table_set(Table *table, String *key, Value value) {
  * 如果原本不存在，不进行修改，返回1;
  * 如果该entry为const，不进行修改，返回2;
  * 如果public_only为真，但找到的entry不为public，不进行修改，返回3
- * 该函数可能导致gc
  */
 char table_set_existent(Table *table, String *key, Value value, bool public_only) {
-    if (need_resize(table)) {
-        table_resize(table);
+    if (table->count == 0) {
+        return 1;
     }
-    int hash = key->hash;
-    for (int i = 0; i < table->capacity; ++i) {
-        int curr = MODULO(hash + i, table->capacity);
-        Entry *entry = table->backing + curr;
-        if (empty_entry(entry)) {
-            return 1;
-        } else if(entry->key == key) {
-            if (entry->is_const) {
-                return 2;
-            } else if (public_only && !entry->is_public){
-                return 3;
-            } else {
-                entry->value = value;
-                return 0;
-            }
-        }
+    int index = probe_key(table, key, NULL);
+    if (index == -1) {
+        return 1;
+    }
+    Entry *entry = table->backing + index;
+    if (entry->is_const) {
+        return 2;
+    } else if (public_only && !entry->is_public) {
+        return 3;
+    } else {
+        entry->value = value;
+        return 0;
     }
-    return 1;
 }
 
 /**
@@ -201,47 +341,26 @@ char table_set_existent(Table *table, String *key, Value value, bool public_only
  * 该函数可能导致gc
  */
 bool table_add_new(Table *table, String *key, Value value, bool is_public, bool is_const) {
-
-    if (need_resize(table)) {
+    if (need_resize(table) || need_shrink(table)) {
         table_resize(table);
     }
-    Entry *mark = NULL;
-    int hash = key->hash;
-    for (int i = 0; i < table->capacity; ++i) {
-        int curr = MODULO(hash + i, table->capacity);
-        Entry *entry = table->backing + curr;
-        if (empty_entry(entry)) {
-            if (mark == NULL) {
-                entry->key = key;
-                entry->value = value;
-                entry->is_public = is_public;
-                entry->is_const = is_const;
-                table->count++;
-            } else {
-                mark->key = key;
-                mark->value = value;
-                mark->is_public = is_public;
-                mark->is_const = is_const;
-            }
-            return true;
-        } else if(entry->key == key) {
-            return false;
-        } else if (mark == NULL && del_mark(entry)) {
-            mark = entry;
-        }
+    if (probe_key(table, key, NULL) != -1) {
+        return false;
     }
-    IMPLEMENTATION_ERROR("table_add() does not find empty spot");
-    return false;
+    fill_slot(table, probe_free_slot(table, key->hash), key, value, is_public, is_const);
+    return true;
 }
 
 Value table_delete(Table *table, String *key) {
     if (table->count == 0) {
         return nil_value();
     }
-    Entry *entry = table_find_entry(table, key, false, false);
-    entry->key = NULL;
-    Value result = entry->value;
-    entry->value = bool_value(true);
+    int index = probe_key(table, key, NULL);
+    if (index == -1) {
+        return nil_value();
+    }
+    Value result = table->backing[index].value;
+    erase_slot(table, index);
     return result;
 }
 
@@ -271,18 +390,24 @@ void table_mark(Table *table) {
     }
 }
 
+/**
+ * 只标记value。key是弱引用，不可达的key由table_delete_unreachable()移除
+ */
+void table_mark_values(Table *table) {
+    for (int i = 0; i < table->capacity; ++i) {
+        mark_value(table->backing[i].value);
+    }
+}
+
 /**
  * 该函数仅仅从table中删除对应的元素，并不清除内存。free_object会在sweep函数中执行。
  */
 void table_delete_unreachable(Table *table) {
     for (int i = 0; i < table->capacity; ++i) {
         Entry *entry = table->backing + i;
-        if (entry != NULL) {
-            Object *object = (Object*) entry->key;
-            if (entry->key != NULL && !object->is_marked) {
-                entry->key = NULL;
-                entry->value = bool_value(true);
-            }
+        Object *object = (Object*) entry->key;
+        if (entry->key != NULL && !object->is_marked) {
+            erase_slot(table, i);
         }
     }
 }
@@ -291,29 +416,35 @@ String *table_find_string(Table *table, const char *name, int length, uint32_t h
     if (table->count == 0) {
         return NULL;
     }
-    for (int i = 0; i < table->capacity; ++i) {
-        int curr = MODULO(hash + i, table->capacity);
-        Entry *entry = table->backing + curr;
-        if (empty_entry(entry)) {
-            return NULL;
-        }
-        if (entry->key == NULL || entry->key->hash != hash || entry->key->length != length) {
-            continue;
+    int8_t tag = hash_tag(hash);
+    uint32_t mask = group_mask(table);
+    for (uint32_t group = (hash >> 7) & mask;; group = (group + 1) & mask) {
+        int base = (int) group * GROUP_WIDTH;
+        const int8_t *ctrl = table->control + base;
+        for (GroupMask match = group_match(ctrl, tag); match != 0; match &= match - 1) {
+            String *key = table->backing[base + __builtin_ctz(match)].key;
+            if (key->hash == hash && key->length == length && memcmp(key->chars, name, length) == 0) {
+                return key;
+            }
         }
-        if (memcmp(entry->key->chars, name, length) == 0) {
-            return entry->key;
+        if (group_match_empty(ctrl) != 0) {
+            return NULL;
         }
     }
-    return NULL;
 }
 
 void init_table(Table *table) {
     table->backing = NULL;
+    table->control = NULL;
     table->capacity = 0;
     table->count = 0;
+    table->deleted = 0;
 }
 
 void free_table(Table *table) {
     FREE_ARRAY(Entry, table->backing, table->capacity);
+    if (table->control != NULL) {
+        FREE_ARRAY(int8_t, table->control, control_length(table->capacity));
+    }
     init_table(table);
 }
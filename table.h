@@ -14,10 +14,17 @@ typedef struct Entry {
     bool is_public;
 } Entry;
 
+/**
+ * control与backing一一对应，每个entry用一个字节描述其状态：
+ * 空位、删除标记，或者是key的hash的低7位。查找时先按组比较control，只有hash片段相同的entry才会被访问。
+ * 当capacity小于一组的宽度时，control的长度仍为一组，多余的字节始终为空位
+ */
 typedef struct Table {
-    int count;
+    int count; // 包含删除标记
+    int deleted; // 删除标记的数量
     int capacity;
     Entry *backing;
+    int8_t *control;
 } Table;
 
 void init_table(Table *table);
@@ -33,6 +40,7 @@ Value table_delete(Table *table, String *key);
 void table_add_all(Table *from, Table *to, bool public_only);
 String *table_find_string(Table *table, const char *name, int length, uint32_t hash);
 void table_mark(Table *table);
+void table_mark_values(Table *table);
 void table_delete_unreachable(Table *table);
 
 #endif
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "value.h"
 
 #include <string.h>
+#include <limits.h>
+#include <math.h>
 
 #include "memory.h"
 #include "object.h"
@@ -23,15 +25,14 @@ char *BOLD_BLUE = "\033[1;94m";
 char *BOLD_MAGENTA = "\033[1;95m";
 
 inline void start_color(char *color) {
-    printf("%s", color);
+    fputs(color, stdout);
 }
 
 inline void end_color() {
-    printf("\033[0m");
+    fputs("\033[0m", stdout);
 }
 
 void print_value_with_color(Value value) {
-    char *str = value_to_chars(value, NULL);
     switch (value.type) {
         case VAL_INT:
         case VAL_FLOAT:
@@ -71,9 +72,8 @@ void print_value_with_color(Value value) {
             break;
         }
     }
-    printf("%s", str);
+    print_value(value);
     end_color();
-    free(str);
 }
 
 static char *ref_to_chars(Value value, int *len);
@@ -114,16 +114,25 @@ bool value_equal(Value a, Value b) {
         case VAL_NIL:
         case VAL_ABSENCE:
             return true;
-        case VAL_REF:
-            return as_ref(a) == as_ref(b);
+        case VAL_REF: {
+            if (as_ref(a) == as_ref(b)) {
+                return true;
+            }
+            // 同值的interned String具有相同的地址，其他String需要比较内容
+            if (is_ref_of(a, OBJ_STRING) && is_ref_of(b, OBJ_STRING)) {
+                String *a_str = as_string(a);
+                String *b_str = as_string(b);
+                return !(a_str->is_interned && b_str->is_interned) && object_equal(as_ref(a), as_ref(b));
+            }
+            return false;
+        }
         default:
             return true;
     }
 }
 
 /**
- * 旧版的比较。由于interned string的实现，所有同值的String都具有相同的地址。
- * 因此直接比较地址即可。
+ * 比较两个String的内容。
  */
 bool object_equal(Object *a, Object *b) {
     if (a->type != b->type) {
@@ -133,6 +142,9 @@ bool object_equal(Object *a, Object *b) {
         case OBJ_STRING: {
             String *a_str = (String *) a;
             String *b_str = (String *) b;
+            if (a_str->is_hashed && b_str->is_hashed && a_str->hash != b_str->hash) {
+                return false;
+            }
             return a_str->length == b_str->length &&
                    memcmp(a_str->chars, b_str->chars, a_str->length) == 0;
         }
@@ -148,7 +160,8 @@ static char *ref_to_chars(Value value, int *len) {
         case OBJ_STRING: {
             String *str = as_string(value);
             buffer = malloc(str->length + 1);
-            memcpy(buffer, str->chars, str->length + 1);
+            memcpy(buffer, str->chars, str->length);
+            buffer[str->length] = '\0';
             *len = str->length;
             break;
         }
@@ -234,9 +247,14 @@ static char *ref_to_chars(Value value, int *len) {
  * @param value 想要打印的 value
  */
 void print_value(Value value) {
-    char *str = value_to_chars(value, NULL);
-    printf("%s", str);
-    free(str);
+    char buffer[VALUE_BUFFER_SIZE];
+    int len;
+    bool allocated;
+    const char *str = value_chars(value, buffer, &len, &allocated);
+    fwrite(str, 1, len, stdout);
+    if (allocated) {
+        free((char *) str);
+    }
 }
 
 //int ref_chars_len(Value value) {
@@ -461,6 +479,104 @@ void print_value(Value value) {
 //    }
 //}
 
+static const char DIGIT_PAIRS[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+/**
+ * 将value的十进制表达写入buffer，每次产生两位数字
+ * @param buffer 长度至少为VALUE_BUFFER_SIZE
+ * @return 写入的长度，不包括结尾的'\0'
+ */
+int format_int(int value, char *buffer) {
+    char temp[12];
+    char *p = temp + sizeof(temp);
+    uint32_t u = value < 0 ? 0u - (uint32_t) value : (uint32_t) value;
+    while (u >= 100) {
+        const char *pair = DIGIT_PAIRS + (u % 100) * 2;
+        u /= 100;
+        *--p = pair[1];
+        *--p = pair[0];
+    }
+    if (u >= 10) {
+        *--p = DIGIT_PAIRS[u * 2 + 1];
+        *--p = DIGIT_PAIRS[u * 2];
+    } else {
+        *--p = (char) ('0' + u);
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+    int len = (int) (temp + sizeof(temp) - p);
+    memcpy(buffer, p, len);
+    buffer[len] = '\0';
+    return len;
+}
+
+/**
+ * 将value的字符串表达写入buffer。Int范围内的整数值写作"x.0"，其他值与"%.10g"相同
+ * @param buffer 长度至少为VALUE_BUFFER_SIZE
+ * @return 写入的长度，不包括结尾的'\0'
+ */
+int format_float(double value, char *buffer) {
+    if (value >= INT_MIN && value <= INT_MAX && value == (int) value) {
+        int len = format_int((int) value, buffer);
+        if (value == 0 && signbit(value)) {
+            memmove(buffer + 1, buffer, len);
+            buffer[0] = '-';
+            len++;
+        }
+        memcpy(buffer + len, ".0", 3);
+        return len + 2;
+    }
+    return snprintf(buffer, VALUE_BUFFER_SIZE, "%.10g", value);
+}
+
+/**
+ * 获取value的字符串表达而不分配内存：String直接返回其chars，数字、Bool、nil写入buffer。
+ * 只有其他对象通过value_to_chars()分配，此时*allocated为true，调用者需要free返回值。
+ * 返回值不一定以'\0'结尾，应使用*len
+ * @param buffer 长度至少为VALUE_BUFFER_SIZE
+ */
+const char *value_chars(Value value, char *buffer, int *len, bool *allocated) {
+    *allocated = false;
+    switch (value.type) {
+        case VAL_INT:
+            *len = format_int(as_int(value), buffer);
+            return buffer;
+        case VAL_FLOAT:
+            *len = format_float(as_float(value), buffer);
+            return buffer;
+        case VAL_BOOL:
+            *len = as_bool(value) ? 4 : 5;
+            return as_bool(value) ? "true" : "false";
+        case VAL_NIL:
+            *len = 3;
+            return "nil";
+        case VAL_ABSENCE:
+            *len = 7;
+            return "absence";
+        case VAL_REF:
+            if (is_ref_of(value, OBJ_STRING)) {
+                *len = as_string(value)->length;
+                return as_string(value)->chars;
+            }
+            *allocated = true;
+            return value_to_chars(value, len);
+        default:
+            *allocated = true;
+            return value_to_chars(value, len);
+    }
+}
+
 /**
  * 获取目标 value 的char*表达。调用者需要自己 free 之。
  * 如果传入的len不为NULL，则将生成的字符串长度储存在其中
@@ -474,16 +590,17 @@ char *value_to_chars(Value value, int *len) {
 
     switch (value.type) {
         case VAL_FLOAT: {
-            double decimal = as_float(value);
-            if (decimal == (int) decimal) {
-                *len = asprintf(&buffer, "%.1f", decimal);
-            } else {
-                *len = asprintf(&buffer, "%.10g", as_float(value));
-            }
+            char temp[VALUE_BUFFER_SIZE];
+            *len = format_float(as_float(value), temp);
+            buffer = malloc(*len + 1);
+            memcpy(buffer, temp, *len + 1);
             break;
         }
         case VAL_INT: {
-            *len = asprintf(&buffer, "%d", as_int(value));
+            char temp[VALUE_BUFFER_SIZE];
+            *len = format_int(as_int(value), temp);
+            buffer = malloc(*len + 1);
+            memcpy(buffer, temp, *len + 1);
             break;
         }
         case VAL_BOOL: {
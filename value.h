@@ -43,6 +43,12 @@ void free_ValueArray(ValueArray *array);
 void print_value(Value value);
 char *value_to_chars(Value value, int *len);
 
+#define VALUE_BUFFER_SIZE 32 // 足以容纳任何Int、Float、Bool、nil的字符串表达
+
+int format_int(int value, char *buffer);
+int format_float(double value, char *buffer);
+const char *value_chars(Value value, char *buffer, int *len, bool *allocated);
+
 #define is_bool(value) ((value).type == VAL_BOOL)
 #define is_float(value) ((value).type == VAL_FLOAT)
 #define is_number(value) ((value).type == VAL_FLOAT || (value).type == VAL_INT )
@@ -13,9 +13,11 @@
 #include "object.h"
 #include "time.h"
 #include "math.h"
+#include "unistd.h"
 
 #include "stdarg.h"
 #include "setjmp.h"
+#include "string.h"
 
 VM vm;
 Module *repl_module = NULL;
@@ -163,10 +165,56 @@ static inline void stack_swap(int n) {
     stack_set(0, temp);
 }
 
-static inline void invoke_and_wait(String *name, int arg_count) {
-    int count = vm.frame_count;
+/**
+ * 每一层invoke_and_wait()在C栈上的记录，由内向外链接。
+ * 该层的run_frame_until()执行下标不低于boundary的栈帧；更低的栈帧由外层执行。
+ * 只有含有try的函数进入了该层时才设置buf：没有栈帧能够捕获异常的层不需要跳转点
+ */
+typedef struct WaitPoint {
+    int boundary;
+    jmp_buf buf; // 异常被该层的栈帧捕获时，由此回到该层，继续执行run_frame_until()
+    bool armed; // buf是否已经设置
+    bool needs_arm; // 含有try的函数进入了该层，在它执行第一条指令之前需要设置buf
+    int depth; // 嵌套的层数，最外层为1
+    struct WaitPoint *outer;
+} WaitPoint;
+
+static WaitPoint *wait_point = NULL; // 最内层的invoke_and_wait()。为NULL时，所有栈帧都由最外层的run_frame_until()执行
+
+/**
+ * 新的栈帧开始执行function时调用。function含有try时，其栈帧可能捕获异常，最内层的wait point需要跳转点
+ */
+static inline void enter_function(LoxFunction *function) {
+    if (function->chunk.exception_count > 0 && wait_point != NULL && !wait_point->armed) {
+        wait_point->needs_arm = true;
+    }
+}
+
+/**
+ * 可能压入栈帧的指令执行后检查。需要时，run_frame_until()返回INTERPRET_ARM_WAIT_POINT，由invoke_and_wait()设置跳转点后继续执行
+ */
+static inline bool wait_point_needs_arm() {
+    return wait_point != NULL && wait_point->needs_arm;
+}
+
+static void invoke_and_wait(String *name, int arg_count) {
+    WaitPoint point;
+    point.depth = wait_point == NULL ? 1 : wait_point->depth + 1;
+    if (point.depth > WAIT_DEPTH_LIMIT) {
+        throw_new_runtime_error(Error_FatalError, "FatalError: Stack overflow");
+    }
+    point.boundary = vm.frame_count;
+    point.armed = false;
+    point.needs_arm = false;
+    point.outer = wait_point;
+    wait_point = &point;
     invoke_property(name, arg_count);
-    run_frame_until(count);
+    while (run_frame_until(point.boundary) == INTERPRET_ARM_WAIT_POINT) {
+        point.needs_arm = false;
+        point.armed = true;
+        setjmp(point.buf); // 从throw_value()或catch()返回时，wait_point已经指向point
+    }
+    wait_point = point.outer;
 }
 
 static void string_indexing_get() {
@@ -180,7 +228,7 @@ static void string_indexing_get() {
         throw_user_level_runtime_error(Error_IndexError, "IndexError: index %d is out of bound: [0, %d]", index,
                                        str->length - 1);
     } else {
-        String *char_at_index = string_copy(str->chars + index, 1);
+        String *char_at_index = vm.single_byte_strings[(uint8_t) str->chars[index]];
         stack_push(ref_value_cast(char_at_index));
     }
 }
@@ -218,197 +266,299 @@ static void array_indexing_set() {
 }
 
 /**
- * [map, key] -> [value]。
- * 如果没有找到，将使用throw_value()抛出IndexError（用户级别）。
+ * 在map中寻找位于栈顶的key，栈在调用前后保持不变。对hash相同的entry，调用equal()进行比较
+ * @param free_slot 如果不为NULL且key不存在，则在此储存探查过程中遇到的第一个可用于插入的index位置
+ * @return key在index中的位置。如果不存在，返回-1
  */
-static void map_indexing_get() {
-    // [map, key0]
-    Map *map = as_map(stack_peek(1));
-    if (map->active_count == 0) {
-        stack_pop();
-        stack_pop();
-        throw_user_level_runtime_error(Error_IndexError, "IndexError: the key does not exist");
-        return;
-    }
-    stack_push(stack_peek(0)); // [map, key0, key0]
-    invoke_and_wait(HASH, 0);
-    Value hash_result = stack_pop();
-    assert_value_type(hash_result, VAL_INT, "int");
-    int hash = as_int(hash_result); // [map, key0, hash]
+static int map_find_slot(Map *map, int hash, int *free_slot) {
+    int first_deleted = -1;
     for (int i = 0; i < map->capacity; ++i) {
-        int curr = MODULO(hash + i, map->capacity);
-        MapEntry *entry = map->backing + curr;
-        if (map_empty_entry(entry)) {
-            stack_pop();
-            stack_pop();
-            throw_user_level_runtime_error(Error_IndexError, "IndexError: the key does not exist");
-            return;
-        } else if (!is_absence(entry->key) && entry->hash == hash) {
-            stack_push(entry->key); // map, key0, key1
-            stack_push(stack_peek(1)); // map, key0, key1, key0
-            invoke_and_wait(EQUAL, 1); // map, key0, bool
-            Value cmp_result = stack_pop(); // map, key0
-            assert_value_type(cmp_result, VAL_BOOL, "bool");
-            bool eq = as_bool(cmp_result);
-            if (eq) {
-                stack_pop();
-                stack_pop();
-                stack_push(entry->value);
-                return;
+        int slot = MODULO((unsigned int) hash + i, map->capacity);
+        int entry_index = map->index[slot];
+        if (entry_index == MAP_SLOT_EMPTY) {
+            if (free_slot != NULL) {
+                *free_slot = first_deleted == -1 ? slot : first_deleted;
+            }
+            return -1;
+        } else if (entry_index == MAP_SLOT_DELETED) {
+            if (first_deleted == -1) {
+                first_deleted = slot;
+            }
+        } else if (map->backing[entry_index].hash == hash) {
+            stack_push(map->backing[entry_index].key); // key0, key1
+            stack_push(stack_peek(1)); // key0, key1, key0
+            invoke_and_wait(EQUAL, 1); // key0, bool
+            Value eq_result = stack_pop(); // key0
+            assert_value_type(eq_result, VAL_BOOL, "bool");
+            if (as_bool(eq_result)) {
+                return slot;
             }
         }
     }
-    // not found
-    stack_pop();
-    stack_pop();
-    throw_user_level_runtime_error(Error_IndexError, "IndexError: the key does not exist");
+    if (free_slot != NULL) {
+        *free_slot = first_deleted;
+    }
+    return -1;
 }
 
 /**
- * [map, key0, value0, hash] -> [map | value]
- * @param keep_map true: keep the map on the top of the stack, false: keep value on top
+ * 按照hash寻找第一个可用于插入的index位置。调用者需保证key不在map中
+ */
+static int map_free_slot(Map *map, int hash) {
+    for (int i = 0; i < map->capacity; ++i) {
+        int slot = MODULO((unsigned int) hash + i, map->capacity);
+        if (map->index[slot] < 0) {
+            return slot;
+        }
+    }
+    runtime_error("map cannot find empty spot, this is an implementation error!");
+    return -1;
+}
+
+/**
+ * 以new_capacity重新分配map，移除已删除的entry并重建index。容量不变时，在原有的空间中就地完成。
+ * 剩余的entry保持插入顺序，并且互不相等，因此只需按照储存的hash放置，不需要调用hash()和equal()
+ */
+static void map_rebuild(Map *map, int new_capacity) {
+    bool in_place = new_capacity == map->capacity;
+    MapEntry *new_backing = in_place ? map->backing : ALLOCATE(MapEntry, MAP_USABLE(new_capacity));
+    int *new_index = in_place ? map->index : ALLOCATE(int, new_capacity);
+    for (int i = 0; i < new_capacity; ++i) {
+        new_index[i] = MAP_SLOT_EMPTY;
+    }
+
+    int count = 0;
+    for (int i = 0; i < map_length(map); ++i) {
+        MapEntry *entry = map->backing + i;
+        if (is_absence(entry->key)) {
+            continue;
+        }
+        unsigned int slot = entry->hash;
+        while (new_index[MODULO(slot, new_capacity)] != MAP_SLOT_EMPTY) {
+            slot++;
+        }
+        new_index[MODULO(slot, new_capacity)] = count;
+        new_backing[count++] = *entry;
+    }
+
+    if (!in_place) {
+        FREE_ARRAY(MapEntry, map->backing, MAP_USABLE(map->capacity));
+        FREE_ARRAY(int, map->index, map->capacity);
+    }
+    map->backing = new_backing;
+    map->index = new_index;
+    map->capacity = new_capacity;
+    map->active_count = count;
+    map->del_count = 0;
+}
+
+/**
+ * @return 容纳live个entry，并且在此基础上还能插入同样多的entry而不需要重建的最小容量
+ */
+static int map_capacity_for(int live) {
+    int capacity = 8;
+    while (MAP_USABLE(capacity) < live * 2) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * 清空map。较大的空间会被释放，否则就地重置
+ */
+static void map_clear(Map *map) {
+    if (map->capacity > 8) {
+        FREE_ARRAY(MapEntry, map->backing, MAP_USABLE(map->capacity));
+        FREE_ARRAY(int, map->index, map->capacity);
+        map->backing = NULL;
+        map->index = NULL;
+        map->capacity = 0;
+    } else {
+        for (int i = 0; i < map->capacity; ++i) {
+            map->index[i] = MAP_SLOT_EMPTY;
+        }
+    }
+    map->active_count = 0;
+    map->del_count = 0;
+}
+
+/**
+ * 预先分配空间，使map在容纳count个entry之前都不需要重建
+ * @param count 不能超过MAP_USABLE(MAP_CAPACITY_MAX)
  */
-static void map_indexing_set_with_hash(bool keep_map) {
+void map_reserve(Map *map, int count) {
+    int new_capacity = 8;
+    while (MAP_USABLE(new_capacity) < count) {
+        new_capacity *= 2;
+    }
+    if (new_capacity > map->capacity) {
+        map_rebuild(map, new_capacity);
+    }
+}
 
-    Map *map = as_map(stack_peek(3));
-    Value hash_result = stack_pop(); // map, key0, value
+/**
+ * 调用栈顶的key的hash()，栈在调用前后保持不变
+ */
+static int map_hash_key() {
+    stack_push(stack_peek(0));
+    invoke_and_wait(HASH, 0);
+    Value hash_result = stack_pop();
     assert_value_type(hash_result, VAL_INT, "int");
-    MapEntry *del_mark = NULL;
+    return as_int(hash_result);
+}
 
-    int hash = as_int(hash_result); // map, key0, value
+/**
+ * 在map中寻找位于栈顶的key，栈在调用前后保持不变。只探查一次，不存在时也不会抛出异常。
+ * 调用者需保证map不会被gc
+ * @return key对应的entry，如果不存在，返回NULL
+ */
+MapEntry *map_lookup(Map *map) {
+    if (map->active_count == 0) {
+        return NULL;
+    }
+    int slot = map_find_slot(map, map_hash_key(), NULL);
+    return slot == -1 ? NULL : map->backing + map->index[slot];
+}
+
+/**
+ * 不调用hash()和equal()，直接用value_hash()和value_equal()在map中寻找key。
+ * 只适用于Int、String等相等性由虚拟机决定的key，例如switch的跳转表
+ * @return key对应的entry，如果不存在，返回NULL
+ */
+MapEntry *map_find_native(Map *map, Value key) {
+    if (map->active_count == 0) {
+        return NULL;
+    }
+    int hash = (int) value_hash(key);
     for (int i = 0; i < map->capacity; ++i) {
-        int curr = MODULO(hash + i, map->capacity);
-        MapEntry *entry = map->backing + curr;
-        if (map_empty_entry(entry)) {
-            if (del_mark == NULL) {
-                entry->value = stack_pop(); // -> map, key0
-                entry->key = stack_pop(); //  -> [map]
-                entry->hash = hash;
-                map->active_count++;
-                if (!keep_map) {
-                    stack_pop(); // -> [ ]
-                    stack_push(entry->value); // -> [value]
-                }
-                return;
-            } else {
-                del_mark->value = stack_pop();
-                del_mark->key = stack_pop(); // -> [map]
-                del_mark->hash = hash;
-                if (!keep_map) {
-                    stack_pop();
-                    stack_push(del_mark->value); // -> [value]
-                }
-                map->del_count --;
-                return;
-            }
-        } else if (del_mark == NULL && map_del_mark(entry)) {
-            del_mark = entry;
-        } else if (entry->hash == hash) {
-            // [map, key0, value]
-            stack_push(entry->key); // map, key0, value, key1
-            stack_push(stack_peek(2)); // map, k0, v, k1, k0
-            invoke_and_wait(EQUAL, 1);
-            // map, k0, v, bool
-            Value eq_result = stack_pop(); // map, k0, v
-            assert_value_type(eq_result, VAL_BOOL, "bool");
-            bool eq = as_bool(eq_result);
-            if (eq) {
-                entry->value = stack_pop(); // map, k0
-                stack_pop();  // map
-                if (!keep_map) {
-                    stack_pop();
-                    stack_push(entry->value); // -> [value]
-                }
-                return;
+        int entry_index = map->index[MODULO((unsigned int) hash + i, map->capacity)];
+        if (entry_index == MAP_SLOT_EMPTY) {
+            return NULL;
+        }
+        if (entry_index != MAP_SLOT_DELETED) {
+            MapEntry *entry = map->backing + entry_index;
+            if (entry->hash == hash && value_equal(entry->key, key)) {
+                return entry;
             }
         }
     }
-    runtime_error("map cannot find empty spot, this is an implementation error!");
+    return NULL;
+}
+
+/**
+ * 与map_find_native()对应的插入。如果key已经存在，不做任何修改
+ */
+void map_add_native(Map *map, Value key, Value value) {
+    if (map_find_native(map, key) != NULL) {
+        return;
+    }
+    if (map->capacity == 0 || map_need_resize(map)) {
+        map_rebuild(map, map_capacity_for(map->active_count));
+    }
+    int hash = (int) value_hash(key);
+    int entry_index = map_length(map);
+    MapEntry *entry = map->backing + entry_index;
+    entry->key = key;
+    entry->value = value;
+    entry->hash = hash;
+    map->index[map_free_slot(map, hash)] = entry_index;
+    map->active_count++;
+}
+
+/**
+ * [map, key] -> [value]。
+ * 如果没有找到，将使用throw_value()抛出IndexError（用户级别）。
+ */
+static void map_indexing_get() {
+    // [map, key0]
+    MapEntry *entry = map_lookup(as_map(stack_peek(1)));
+    stack_pop();
+    stack_pop();
+    if (entry == NULL) {
+        throw_user_level_runtime_error(Error_IndexError, "IndexError: the key does not exist");
+        return;
+    }
+    stack_push(entry->value);
 }
 
 /**
  * [map, key0, value] -> [map | value]
+ * @param keep_map true: keep the map on the top of the stack, false: keep value on top
  */
 static void map_indexing_set(bool keep_map) {
     // map, key0, value
     Map *map = as_map(stack_peek(2));
+    stack_push(stack_peek(1)); // map, key0, value, key0
+    int hash = map_hash_key();
+    int free_slot = -1;
+    int slot = map->capacity == 0 ? -1 : map_find_slot(map, hash, &free_slot);
+    stack_pop(); // map, key0, value
 
-    if (map_need_resize(map)) {
-        int new_capacity = map->capacity < 8 ? 8 : map->capacity * 2;
-        MapEntry *new_backing = ALLOCATE(MapEntry, new_capacity);
-        for (int i = 0; i < new_capacity; ++i) {
-            new_backing[i].key = absence_value();
-            new_backing[i].value = absence_value();
-        }
-        Map *m2 = new_map();
-        m2->backing = new_backing;
-        m2->capacity = new_capacity;
-        stack_push(ref_value((Object *) m2)); // map, k0, v, m2
-        for (int i = 0; i < map->capacity; ++i) {
-            MapEntry *entry = map->backing + i;
-            if (!is_absence(entry->key)) {
-                stack_push(entry->key);
-                stack_push(entry->value);
-                stack_push(int_value(entry->hash));
-
-                // map, k0, v, m2, k1, v1, hash1
-                map_indexing_set_with_hash(true);
-                // map, k0, v, m2
-            }
+    if (slot != -1) {
+        map->backing[map->index[slot]].value = stack_peek(0);
+    } else {
+        // 只在插入时重建，删除不会移动entry，因此在迭代中删除是安全的
+        if (map_need_resize(map) || map_need_shrink(map)) {
+            map_rebuild(map, map_capacity_for(map->active_count));
+            free_slot = map_free_slot(map, hash);
         }
-        // map, k0, v, m2
-        FREE_ARRAY(MapEntry, map->backing, map->capacity);
-        map->backing = new_backing;
-        map->capacity = new_capacity;
-        map->active_count = m2->active_count;
-        map->del_count = 0;
-        m2->backing = NULL;
-        m2->capacity = 0;
-        m2->active_count = 0;
-        stack_pop(); // map, k0, v
+        int entry_index = map_length(map);
+        MapEntry *entry = map->backing + entry_index;
+        entry->key = stack_peek(1);
+        entry->value = stack_peek(0);
+        entry->hash = hash;
+        map->index[free_slot] = entry_index;
+        map->active_count++;
     }
 
-    stack_push(stack_peek(1)); // map, key0, value, key0
-    invoke_and_wait(HASH, 0);
-    // map, key0, value, hash
-
-    map_indexing_set_with_hash(keep_map);
-    // map | value
+    Value value = stack_pop(); // map, key0
+    stack_pop(); // map
+    if (!keep_map) {
+        stack_pop();
+        stack_push(value); // -> [value]
+    }
 }
 
 void map_delete() {
     // [map, key] -> [map, key, value]
     Map *map = as_map(stack_peek(1));
-    stack_push(stack_peek(0)); // [map, key, key]
-    invoke_and_wait(HASH, 0); // [map, key, hash]
-    Value hash_result = stack_pop(); // map, key0, value
-    assert_value_type(hash_result, VAL_INT, "int");
-    int hash = as_int(hash_result); // map, key0, value
-    int index = MODULO(hash, map->capacity);
-    for (int i = 0; i < map->capacity; ++i) {
-        int curr = MODULO(index + i, map->capacity);
-        MapEntry *entry = map->backing + curr;
-        if (map_empty_entry(entry)) {
-            throw_new_runtime_error(Error_IndexError, "IndexError: the key does not exist");
-            return;
-        } else if (!map_del_mark(entry) && entry->hash == hash) {
-            stack_push(entry->key); // map, key0, key1
-            stack_push(stack_peek(1)); // map, k0, k1, k0
-            invoke_and_wait(EQUAL, 1);
-            // map, k0, bool
-            Value eq_result = stack_pop(); // map, k0
-            assert_value_type(eq_result, VAL_BOOL, "bool");
-            bool eq = as_bool(eq_result);
-            if (eq) {
-                stack_push(entry->value); // [map, key, value]
-                map->active_count --;
-                map->del_count ++;
-                entry->key = absence_value();
-                return;
-            }
-        }
+    if (map->active_count == 0) {
+        throw_new_runtime_error(Error_IndexError, "IndexError: the key does not exist");
+        return;
+    }
+    int slot = map_find_slot(map, map_hash_key(), NULL);
+    if (slot == -1) {
+        throw_new_runtime_error(Error_IndexError, "IndexError: the key does not exist");
+        return;
+    }
+    MapEntry *entry = map->backing + map->index[slot];
+    stack_push(entry->value); // [map, key, value]
+    entry->key = absence_value();
+    entry->value = nil_value();
+    map->index[slot] = MAP_SLOT_DELETED;
+    map->active_count --;
+    map->del_count ++;
+    if (map->active_count == 0) {
+        map_clear(map);
     }
-    throw_new_runtime_error(Error_IndexError, "IndexError: the key does not exist");
+}
+
+/**
+ * Error的position在抛出时只是调用栈的快照，第一次被读取时才格式化为String，并替换原有的快照
+ */
+static Value read_error_position(Instance *err, Value position) {
+    if (!is_backtrace_snapshot(position)) {
+        return position;
+    }
+    stack_push(ref_value((Object *) err)); // prevent gc
+    stack_push(position);
+    Value formatted = backtrace_format(position);
+    stack_pop();
+    stack_push(formatted);
+    table_set(&err->fields, POSITION, formatted);
+    stack_pop();
+    stack_pop();
+    return formatted;
 }
 
 /**
@@ -423,6 +573,8 @@ static void get_property(Value target, String *property_name) {
                 bool found = table_get(&instance->fields, property_name, &result);
                 if (found == false) {
                     result = bind_method(instance->class, property_name, target);
+                } else if (property_name == POSITION) {
+                    result = read_error_position(instance, result);
                 }
                 stack_push(result);
                 break;
@@ -564,7 +716,7 @@ static void invoke_native_object(int arg_count, String *name, NativeObject *nati
                 Map *map = as_map(native_object->values[1]);
                 int curr = as_int(native_object->values[0]);
                 bool has_next = false;
-                for (int i = curr; i < map->capacity; ++i) {
+                for (int i = curr; i < map_length(map); ++i) {
                     if (!is_absence(map->backing[i].key)) {
                         has_next = true;
                         native_object->values[0] = int_value(i);
@@ -574,6 +726,13 @@ static void invoke_native_object(int arg_count, String *name, NativeObject *nati
                 stack_push(bool_value(has_next));
                 return;
             }
+            case NativeStringIter: {
+                // curr, string
+                stack_pop();
+                bool has_next = as_int(native_object->values[0]) < as_string(native_object->values[1])->length;
+                stack_push(bool_value(has_next));
+                return;
+            }
             default:
                 goto error;
         }
@@ -601,6 +760,13 @@ static void invoke_native_object(int arg_count, String *name, NativeObject *nati
                 stack_push(ref_value((Object *)tuple));
                 return;
             }
+            case NativeStringIter: {
+                stack_pop();
+                String *str = as_string(native_object->values[1]);
+                uint8_t c = str->chars[as_int(native_object->values[0])++];
+                stack_push(ref_value((Object *) vm.single_byte_strings[c]));
+                return;
+            }
             default:
                 goto error;
         }
@@ -875,6 +1041,7 @@ static inline void reset_stack() {
     vm.frame_count = 0;
     curr_frame = NULL;
     vm.open_upvalues = NULL;
+    wait_point = NULL;
 }
 
 static inline Value stack_peek(int distance) {
@@ -889,8 +1056,8 @@ static void print_error(Value value) {
         table_get(&err->fields, MESSAGE, &temp);
         String *message = as_string(temp);
         table_get(&err->fields, POSITION, &temp);
-        String *position = as_string(temp);
-        printf("%s\n%s", message->chars, position->chars);
+        String *position = as_string(read_error_position(err, temp));
+        printf("%.*s\n%.*s", message->length, message->chars, position->length, position->chars);
     } else {
         char *str = value_to_chars(value, NULL);
         printf("A non-Error value is thrown: %s\n", str);
@@ -899,8 +1066,23 @@ static void print_error(Value value) {
 }
 
 /**
- * 将虚拟机的状态复原为上一次try时所设置的TrySavePoint。
+ * 在chunk的异常表中寻找包含offset的最内层try块
+ * @return 如果不存在，返回NULL
+ */
+static ExceptionRange *find_exception_range(Chunk *chunk, int offset) {
+    for (int i = 0; i < chunk->exception_count; ++i) {
+        ExceptionRange *range = chunk->exceptions + i;
+        if (range->start <= offset && offset < range->end) {
+            return range;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * 从栈顶的栈帧开始向下，寻找正在执行try块的栈帧，将虚拟机恢复到进入该try块时的状态，并跳转到对应的catch。
  * 如果不存在try，使用longjmp()传递INTERPRET_RUNTIME_ERROR。
+ * 如果catch所在的栈帧属于外层的run_frame_until()，使用catch()回到执行该栈帧的那一层，由其继续执行。
  * @param value 被抛出的值。重置虚拟机后，将之置于栈顶。如果该值是一个Error, 那么在这里设置它的backtrace
  */
 static void throw_value(Value value) {
@@ -910,28 +1092,38 @@ static void throw_value(Value value) {
     if (is_ref_of(value, OBJ_INSTANCE)) {
         if (is_subclass(value_class(value), Error)) {
             Instance *err = as_instance(value);
-            Value bt = native_backtrace(0, NULL);
+            Value bt = backtrace_snapshot();
             table_add_new(&err->fields, POSITION, bt, true, false);
         }
     }
 
-    TrySavePoint *last_save = vm.last_save;
-    if (last_save == NULL) {
-        print_error(value);
-        reset_stack();
-        longjmp(error_buf, INTERPRET_RUNTIME_ERROR);
+    for (int i = vm.frame_count - 1; i >= 0; i--) {
+        CallFrame *frame = vm.frames + i;
+        Chunk *chunk = &frame->closure->function->chunk;
+        // PC已经越过了正在执行的指令的操作码
+        ExceptionRange *range = find_exception_range(chunk, (int) (frame->PC - chunk->code) - 1);
+        if (range == NULL) {
+            continue;
+        }
+        Value *stack_top = frame->FP + range->stack_depth;
+        close_upvalue(stack_top);
+        vm.frame_count = i + 1;
+        vm.stack_top = stack_top;
+        sync_frame_cache();
+        curr_frame->PC = chunk->code + range->handler;
+        stack_push(value);
+        if (wait_point != NULL && i < wait_point->boundary) {
+            while (wait_point != NULL && i < wait_point->boundary) {
+                wait_point = wait_point->outer;
+            }
+            catch(INTERPRET_ERROR_CAUGHT);
+        }
         return;
     }
 
-    close_upvalue(last_save->stack_top);
-    vm.frame_count = last_save->frame_count;
-    vm.stack_top = last_save->stack_top;
-    sync_frame_cache();
-    curr_frame->PC = last_save->PC;
-    stack_push(value);
-
-    vm.last_save = last_save->next; // clean
-    free(last_save);
+    print_error(value);
+    reset_stack();
+    longjmp(error_buf, INTERPRET_RUNTIME_ERROR);
 }
 
 /**
@@ -973,6 +1165,7 @@ void throw_new_runtime_error(ErrorType type, const char *format, ...) {
  * 打印调用栈消息。清空栈。
  */
 void runtime_error(const char *format, ...) {
+    fflush(stdout); // 保证错误消息出现在已经print的内容之后
     fputs("\nRuntime Error: ", stderr);
     va_list args;
     va_start(args, format);
@@ -996,9 +1189,12 @@ void runtime_error(const char *format, ...) {
 
 /**
  * 跳转到错误处理处。
- * 该函数只应该用在runtime_error()后面。
+ * 异常已被捕获时(INTERPRET_ERROR_CAUGHT)，回到执行catch所在栈帧的run_frame_until()：最内层的invoke_and_wait()或最外层
  */
 inline void catch(InterpretResult result) {
+    if (result == INTERPRET_ERROR_CAUGHT && wait_point != NULL) {
+        longjmp(wait_point->buf, result);
+    }
     longjmp(error_buf, result);
 }
 /**
@@ -1130,8 +1326,82 @@ static void invoke_from_class(Class *class, String *name, int arg_count) {
     }
 }
 
-static void call_closure(Closure *closure, int arg_count) {
-    LoxFunction *function = closure->function;
+/**
+ * 将栈和栈帧数组迁移到更大的空间，并重新定位指向旧栈的FP、open upvalue以及stack_top
+ */
+static void grow_stack(int max_stack) {
+    if (vm.frame_count == vm.frame_capacity) {
+        vm.frame_capacity *= 2;
+        vm.frames = realloc(vm.frames, sizeof(CallFrame) * vm.frame_capacity);
+        assert(vm.frames != NULL);
+    }
+    int needed = (int) (vm.stack_top - vm.stack) + max_stack + STACK_HEADROOM;
+    if (needed > vm.stack_capacity) {
+        int new_capacity = vm.stack_capacity;
+        while (new_capacity < needed) {
+            new_capacity *= 2;
+        }
+        Value *old_stack = vm.stack;
+        Value *new_stack = malloc(sizeof(Value) * new_capacity);
+        assert(new_stack != NULL);
+        memcpy(new_stack, old_stack, sizeof(Value) * (vm.stack_top - old_stack));
+        for (int i = 0; i < vm.frame_count; ++i) {
+            vm.frames[i].FP = new_stack + (vm.frames[i].FP - old_stack);
+        }
+        for (UpValue *up = vm.open_upvalues; up != NULL; up = up->next) {
+            up->position = new_stack + (up->position - old_stack);
+        }
+        vm.stack_top = new_stack + (vm.stack_top - old_stack);
+        vm.stack = new_stack;
+        vm.stack_capacity = new_capacity;
+        free(old_stack);
+    }
+    if (vm.frame_count != 0) {
+        sync_frame_cache();
+    }
+}
+
+/**
+ * 确保可以再压入一个栈帧，且栈顶之上有max_stack + STACK_HEADROOM个可用的栈空间。
+ * 新栈帧的FP不高于当前的栈顶，因此足以容纳其所有的值
+ */
+static inline void reserve_frame(int max_stack) {
+    if (vm.frame_count == vm.frame_limit) {
+        throw_new_runtime_error(Error_FatalError, "FatalError: Stack overflow");
+    }
+    if (vm.frame_count == vm.frame_capacity || vm.stack_top + max_stack + STACK_HEADROOM > vm.stack + vm.stack_capacity) {
+        grow_stack(max_stack);
+    }
+}
+
+/**
+ * 只确保栈顶之上有max_stack + STACK_HEADROOM个可用的栈空间，用于复用当前栈帧的尾调用
+ */
+static inline void reserve_stack(int max_stack) {
+    if (vm.stack_top + max_stack + STACK_HEADROOM > vm.stack + vm.stack_capacity) {
+        grow_stack(max_stack);
+    }
+}
+
+/**
+ * 为已经按参数列表调整好的调用压入栈帧。调用前需要reserve_frame()
+ */
+static inline void push_closure_frame(Closure *closure, int arg_count) {
+    vm.frame_count++;
+    curr_frame = vm.frames + vm.frame_count - 1;
+    CallFrame *frame = curr_frame;
+    frame->FP = vm.stack_top - arg_count - 1;
+    frame->PC = closure->function->chunk.code;
+    frame->closure = closure;
+    sync_frame_cache();
+    enter_function(closure->function);
+}
+
+/**
+ * 按照function的参数列表整理栈顶的参数：为缺少的可选参数填入absence，将多余的参数收集为可变参数数组
+ * @return 整理后的参数数量
+ */
+static int settle_arguments(LoxFunction *function, int arg_count) {
     int fixed_arg_count = function->fixed_arg_count;
     int optional_arg_count = function->optional_arg_count;
     if (arg_count >= fixed_arg_count) {
@@ -1144,7 +1414,7 @@ static void call_closure(Closure *closure, int arg_count) {
             }
             arg_count = fixed_arg_count + optional_arg_count;
             if (function->var_arg) {
-                stack_push(ref_value((Object *) new_array(0, false)));
+                stack_push(ref_value((Object *) vm.empty_array));
                 arg_count++;
             }
         } else if (function->var_arg) { // more than expect
@@ -1169,20 +1439,55 @@ static void call_closure(Closure *closure, int arg_count) {
         throw_new_runtime_error(Error_ArgError, "ArgError: %s expects at least %d arguments, but got %d", function->name->chars, fixed_arg_count,
                                 arg_count);
     }
-    if (vm.frame_count == FRAME_MAX) {
-        throw_new_runtime_error(Error_FatalError, "FatalError: Stack overflow");
+    return arg_count;
+}
+
+static void call_closure(Closure *closure, int arg_count) {
+    reserve_frame(closure->function->max_stack);
+    if (arg_count != closure->function->exact_arity) {
+        arg_count = settle_arguments(closure->function, arg_count);
     }
-    vm.frame_count++;
-    curr_frame = vm.frames + vm.frame_count - 1;
-    CallFrame *frame = curr_frame;
-    frame->FP = vm.stack_top - arg_count - 1;
-    frame->PC = function->chunk.code;
-    frame->closure = closure;
+    push_closure_frame(closure, arg_count);
+}
+
+/**
+ * 对closure的尾调用：不压入新的栈帧，而是关闭当前栈帧的upvalue，将callee和参数移动到FP处，然后从头执行closure
+ */
+static void tail_call_closure(Closure *closure, int arg_count) {
+    reserve_stack(closure->function->max_stack);
+    if (arg_count != closure->function->exact_arity) {
+        arg_count = settle_arguments(closure->function, arg_count);
+    }
+    close_upvalue(curr_frame->FP);
+    memmove(curr_frame->FP, vm.stack_top - arg_count - 1, sizeof(Value) * (arg_count + 1));
+    vm.stack_top = curr_frame->FP + arg_count + 1;
+    curr_frame->closure = closure;
+    curr_frame->PC = closure->function->chunk.code;
     sync_frame_cache();
+    enter_function(closure->function);
 }
 
 /**
- * 注意，如果该native是作为method调用的，那么其receiver处于values[-1]的位置
+ * 尾调用：刚刚压入的栈帧取代调用者的栈帧。
+ * 调用者的upvalue被关闭，callee和参数被移动到调用者的FP处
+ */
+static void replace_caller_frame() {
+    CallFrame *caller = vm.frames + vm.frame_count - 2;
+    CallFrame *callee = vm.frames + vm.frame_count - 1;
+    close_upvalue(caller->FP);
+    int slot_count = (int) (vm.stack_top - callee->FP);
+    memmove(caller->FP, callee->FP, sizeof(Value) * slot_count);
+    vm.stack_top = caller->FP + slot_count;
+    caller->closure = callee->closure;
+    caller->PC = callee->PC;
+    vm.frame_count--;
+    sync_frame_cache();
+}
+
+/**
+ * 注意，如果该native是作为method调用的，那么其receiver处于values[-1]的位置。
+ * values指向栈。native通过map_lookup()等调用用户代码后，栈可能已经增长并被移动，values随之失效：
+ * 需要的参数应在调用前读出
  */
 static void call_native(NativeFunction *native , int arg_count) {
     if (native->arity != arg_count && native->arity != -1) {
@@ -1219,7 +1524,9 @@ static void call_value(Value value, int arg_count) {
             Instance *instance = new_instance(class);
             Value init_closure;
             if (table_get(&class->methods, INIT, &init_closure)) {
+                stack_push(ref_value((Object *) instance)); // prevent being gc
                 Method *initializer = new_method(as_closure(init_closure), ref_value((Object *) instance));
+                stack_pop();
                 call_value(ref_value((Object *) initializer), arg_count);
             } else if (arg_count != 0) {
                 throw_new_runtime_error(Error_ArgError, "ArgError: %s does not define init() but got %d arguments", class->name->chars,
@@ -1249,6 +1556,11 @@ static void call_value(Value value, int arg_count) {
 }
 
 void init_VM() {
+    vm.frame_capacity = INITIAL_FRAME_CAPACITY;
+    vm.frames = malloc(sizeof(CallFrame) * vm.frame_capacity);
+    vm.frame_limit = FRAME_LIMIT_DEFAULT;
+    vm.stack_capacity = INITIAL_STACK_CAPACITY;
+    vm.stack = malloc(sizeof(Value) * vm.stack_capacity);
     reset_stack();
     vm.objects = NULL;
     vm.open_upvalues = NULL;
@@ -1257,12 +1569,18 @@ void init_VM() {
     vm.gray_stack = NULL;
     vm.allocated_size = 0;
     vm.next_gc = INITIAL_GC_SIZE;
-    vm.last_save = NULL;
     srand(time(NULL)); // NOLINT(*-msc51-cpp)
+    // 必须在stdout的第一次输出之前设置
+    setvbuf(stdout, vm.output_buffer, isatty(STDOUT_FILENO) ? _IOLBF : _IOFBF, OUTPUT_BUFFER_SIZE);
+    if (getentropy(&vm.hash_seed, sizeof(vm.hash_seed)) != 0) {
+        vm.hash_seed = ((uint64_t) time(NULL) << 32) ^ (uint64_t) getpid() ^ (uint64_t) (uintptr_t) &vm;
+    }
 
     init_table(&vm.builtin);
     init_table(&vm.string_table);
+    init_table(&vm.format_templates);
     init_static_strings();
+    vm.empty_array = new_array(0, false);
 
     init_vm_native();
 }
@@ -1275,11 +1593,15 @@ void init_VM() {
  * @par const_table
  */
 void free_VM() {
+    fflush(stdout);
     free_all_objects();
     free_table(&vm.builtin);
     free_table(&vm.string_table);
+    free_table(&vm.format_templates);
 //    free_table(&vm.globals);
     free(vm.gray_stack);
+    free(vm.frames);
+    free(vm.stack);
 }
 
 /**
@@ -1305,6 +1627,7 @@ InterpretResult interpret(const char *src, const char *path) {
 
     error = setjmp(error_buf);
     if (error == INTERPRET_0 || error == INTERPRET_ERROR_CAUGHT) {
+        wait_point = NULL;
         error = run_frame_until(0);
     }
 
@@ -1363,6 +1686,7 @@ InterpretResult read_run_bytecode(const char *path) {
     InterpretResult error;
     error = setjmp(error_buf);
     if (error == INTERPRET_0 || error == INTERPRET_ERROR_CAUGHT) {
+        wait_point = NULL;
         error = run_frame_until(0);
     }
     return error;
@@ -1409,6 +1733,7 @@ InterpretResult load_bytes_into_builtin(unsigned char *bytes, size_t len, const
 
     error = setjmp(error_buf);
     if (error == INTERPRET_0 || error == INTERPRET_ERROR_CAUGHT) {
+        wait_point = NULL;
         error = run_frame_until(0);
     }
     vm.frame_count = 1; // so that the module at frames[0] won't be gc when doing table_add_all()
@@ -1433,6 +1758,7 @@ static void warmup(LoxFunction *function, const char *path_chars, String *path_s
 
     DISABLE_GC;
 
+    reserve_frame(function->max_stack);
     vm.frame_count++;
 
     curr_frame = vm.frames + vm.frame_count - 1;
@@ -1456,6 +1782,7 @@ static void warmup(LoxFunction *function, const char *path_chars, String *path_s
     sync_frame_cache();
 
     stack_push(ref_value((Object *) closure));
+    enter_function(function);
 
     ENABLE_GC;
 }
@@ -1481,6 +1808,9 @@ static InterpretResult run_frame_until(int end_when) {
     if (vm.frame_count == end_when) {
         return INTERPRET_EXECUTE_OK;
     }
+    if (wait_point_needs_arm()) {
+        return INTERPRET_ARM_WAIT_POINT;
+    }
 
     while (true) {
 
@@ -1600,6 +1930,15 @@ static InterpretResult run_frame_until(int end_when) {
             case OP_LOAD_FALSE:
                 stack_push(bool_value(false));
                 break;
+            case OP_LOAD_INT8:
+                stack_push(int_value((int8_t) read_byte()));
+                break;
+            case OP_LOAD_INT16:
+                stack_push(int_value((int16_t) read_uint16()));
+                break;
+            case OP_LOAD_FLOAT8:
+                stack_push(float_value((int8_t) read_byte()));
+                break;
             case OP_NOT:
                 stack_push(bool_value(is_falsy(stack_pop())));
                 break;
@@ -1728,6 +2067,17 @@ static InterpretResult run_frame_until(int end_when) {
                 }
                 break;
             }
+            case OP_SWITCH: {
+                Map *table = as_map(read_constant16());
+                uint16_t offset = read_uint16();
+                MapEntry *entry = map_find_native(table, stack_peek(0));
+                if (entry != NULL) {
+                    curr_frame->PC = curr_frame->closure->function->chunk.code + as_int(entry->value);
+                } else {
+                    curr_frame->PC += offset;
+                }
+                break;
+            }
             case OP_JUMP_IF_EQUAL: {
                 uint16_t offset = read_uint16();
                 Value b = stack_peek(0);
@@ -1754,7 +2104,47 @@ static InterpretResult run_frame_until(int end_when) {
             case OP_CALL: {
                 int count = read_byte();
                 Value callee = stack_peek(count);
+                // 参数数量恰好匹配的closure调用：将该处改写为OP_CALL_EXACT
+                if (is_ref_of(callee, OBJ_CLOSURE) && as_closure(callee)->function->exact_arity == count
+                    && *curr_frame->PC != OP_ARR_AS_VAR_ARG) {
+                    curr_frame->PC[-2] = OP_CALL_EXACT;
+                }
                 call_value(callee, count);
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
+                break;
+            }
+            case OP_CALL_EXACT: {
+                int count = read_byte();
+                Value callee = stack_peek(count);
+                if (is_ref_of(callee, OBJ_CLOSURE) && as_closure(callee)->function->exact_arity == count) {
+                    reserve_frame(as_closure(callee)->function->max_stack);
+                    push_closure_frame(as_closure(callee), count);
+                } else {
+                    call_value(callee, count);
+                }
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
+                break;
+            }
+            case OP_TAIL_CALL: {
+                int count = read_byte();
+                Value callee = stack_peek(count);
+                if (is_ref_of(callee, OBJ_CLOSURE)) {
+                    tail_call_closure(as_closure(callee), count);
+                } else {
+                    int frame_count = vm.frame_count;
+                    call_value(callee, count);
+                    // native等没有产生新栈帧的调用已经得到结果，由接下来的OP_RETURN返回
+                    if (vm.frame_count > frame_count) {
+                        replace_caller_frame();
+                    }
+                }
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
                 break;
             }
             case OP_MAKE_CLOSURE: {
@@ -1763,9 +2153,21 @@ static InterpretResult run_frame_until(int end_when) {
                  * 然后等到外层函数被调用、内层函数被定义后，内层函数的OP_closure
                  * 才会被执行
                  */
-                Value f = read_constant16();
-                Closure *closure = new_closure(as_function(f));
-                closure->module_of_define = curr_frame->module;
+                LoxFunction *function = as_function(read_constant16());
+                Module *module = curr_frame->closure->module_of_define;
+                if (function->upvalue_count == 0) {
+                    // 不捕获任何变量的closure可以被共享。对于每一个(function, module)，只创建一次
+                    Closure *cached = function->cached_closure;
+                    if (cached == NULL || cached->module_of_define != module) {
+                        cached = new_closure(function);
+                        cached->module_of_define = module;
+                        function->cached_closure = cached;
+                    }
+                    stack_push(ref_value((Object *) cached));
+                    break;
+                }
+                Closure *closure = new_closure(function);
+                closure->module_of_define = module;
                 stack_push(ref_value((Object *) closure));
                 for (int i = 0; i < closure->upvalue_count; ++i) {
                     bool is_local = read_byte();
@@ -1864,6 +2266,9 @@ static InterpretResult run_frame_until(int end_when) {
                 String *name = read_constant_string();
                 int arg_count = read_byte();
                 invoke_property(name, arg_count);
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
                 break;
             }
             case OP_INHERIT: {
@@ -1898,6 +2303,9 @@ static InterpretResult run_frame_until(int end_when) {
                 int arg_count = read_byte();
                 Class *class = as_class(stack_pop());
                 invoke_from_class(class, name, arg_count);
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
                 break;
             }
             case OP_DIMENSION_ARRAY: {
@@ -1987,7 +2395,7 @@ static InterpretResult run_frame_until(int end_when) {
 
                 char *curr_dir = dirname(curr_module_path);
 
-                asprintf(&relative_path, "%s/%s", curr_dir, path->chars);
+                asprintf(&relative_path, "%s/%.*s", curr_dir, path->length, path->chars);
 
                 free(curr_module_path);
 
@@ -1997,12 +2405,15 @@ static InterpretResult run_frame_until(int end_when) {
 
                 char *src = read_file(absolute_path);
                 if (src == NULL) {
-                    throw_user_level_runtime_error(Error_IOError, "IOError: error when reading the file %s (%s)\n", absolute_path, path->chars);
+                    throw_user_level_runtime_error(Error_IOError, "IOError: error when reading the file %s (%.*s)\n", absolute_path, path->length, path->chars);
                 } else {
                     String *path_string = auto_length_string_copy(absolute_path);
                     import(src, path_string);
                     free(src);
                 }
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
                 break;
             }
             case OP_COPY_N: {
@@ -2044,11 +2455,27 @@ static InterpretResult run_frame_until(int end_when) {
             }
             case OP_GET_ITERATOR: {
                 invoke_property(ITERATOR, 0);
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
                 break;
             }
             case OP_JUMP_FOR_ITER: {
                 // [iter]
                 int offset = read_uint16();
+                if (is_ref_of(stack_peek(0), OBJ_NATIVE_OBJECT)) {
+                    // 原生迭代器直接调用invoke_native_object()，不需要经过invoke_and_wait()
+                    NativeObject *iter = as_native_object(stack_peek(0));
+                    stack_push(stack_peek(0));
+                    invoke_native_object(0, HAS_NEXT, iter); // [iter, bool]
+                    if (is_falsy(stack_pop())) {
+                        curr_frame->PC += offset;
+                        break;
+                    }
+                    stack_push(stack_peek(0));
+                    invoke_native_object(0, NEXT, iter); // [iter, item]
+                    break;
+                }
                 stack_push(stack_peek(0)); // [iter, iter]
                 invoke_and_wait(HAS_NEXT, 0); // [iter, bool]
                 if (is_falsy(stack_pop())) {
@@ -2059,6 +2486,9 @@ static InterpretResult run_frame_until(int end_when) {
                 stack_push(stack_peek(0));
                 invoke_property(NEXT, 0);
                 // [iter, item]
+                if (wait_point_needs_arm()) {
+                    return INTERPRET_ARM_WAIT_POINT;
+                }
                 break;
             }
             case OP_MAP_ADD_PAIR: {
@@ -2071,29 +2501,32 @@ static InterpretResult run_frame_until(int end_when) {
                 stack_push(ref_value((Object *) new_map()));
                 break;
             }
-            case OP_SET_TRY: {
-                int offset = read_uint16();
-                TrySavePoint *save_point = malloc(sizeof(TrySavePoint));
-                save_point->frame_count = vm.frame_count;
-                save_point->PC = curr_frame->PC + offset;
-                save_point->stack_top = vm.stack_top;
-                save_point->next = vm.last_save;
-                vm.last_save = save_point;
-                break;
-            }
-            case OP_SKIP_CATCH: {
-                int offset = read_uint16();
-                TrySavePoint *last_save = vm.last_save;
-                vm.last_save = vm.last_save->next;
-                free(last_save);
-                curr_frame->PC += offset;
-                break;
-            }
             case OP_THROW: {
                 Value value = stack_pop();
                 throw_value(value);
                 break;
             }
+            case OP_TEST_IN: {
+                // [key, container] -> [bool]
+                Value container = stack_peek(0);
+                if (is_ref_of(container, OBJ_STRING)) {
+                    Value key = stack_peek(1);
+                    assert_ref_type(key, OBJ_STRING, "String");
+                    bool found = string_find(as_string(container), as_string(key), 0) != -1;
+                    vm.stack_top -= 2;
+                    stack_push(bool_value(found));
+                    break;
+                }
+                if (!is_ref_of(container, OBJ_MAP)) {
+                    throw_user_level_runtime_error(Error_TypeError, "TypeError: the value does not support 'in'");
+                    break;
+                }
+                stack_push(stack_peek(1)); // key, map, key
+                bool found = map_lookup(as_map(container)) != NULL;
+                vm.stack_top -= 3;
+                stack_push(bool_value(found));
+                break;
+            }
             case OP_TEST_VALUE_OF: {
                 int amount = read_byte();
                 // [value, t1, t2, (top)] -> [value, bool]
@@ -15,28 +15,28 @@ typedef struct CallFrame {
     Module *module; // the running module
 } CallFrame;
 
-typedef struct TrySavePoint {
-    int frame_count;
-    uint8_t *PC;
-    Value *stack_top;
-    struct TrySavePoint *next;
-} TrySavePoint;
-
 typedef struct VM{
-    CallFrame frames[FRAME_MAX];
+    CallFrame *frames; // 按需增长
     int frame_count;
-    Value stack[STACK_MAX];
+    int frame_capacity;
+    int frame_limit; // 调用深度的上限。超出时抛出FatalError
+    Value *stack; // 按需增长。增长时，FP和open upvalue的position会被重新定位
     Value *stack_top;
+    int stack_capacity;
     UpValue *open_upvalues;
     Object *objects; // 所有object的值
     Table string_table; // 同名的String只会创建一次。
+    Table format_templates; // f()的模板缓存。interned的format String -> Array，key是弱引用
     Table builtin;
+    String *single_byte_strings[UINT8_MAX + 1]; // 预先intern的所有单字节String
+    Array *empty_array; // 没有收到额外参数时，可变参数共享的空数组。长度为0，因此无法被修改
     int gray_count;
     int gray_capacity;
     Object **gray_stack;
     size_t allocated_size;
     size_t next_gc;
-    TrySavePoint *last_save;
+    uint64_t hash_seed; // 每个进程随机产生，使字符串的hash无法被预测
+    char output_buffer[OUTPUT_BUFFER_SIZE]; // stdout的缓冲区。满、退出、read()、报错时刷新；终端上按行刷新
 } VM ;
 
 extern Module *repl_module;
@@ -54,6 +54,7 @@ typedef enum InterpretResult{
     INTERPRET_BYTECODE_DISASSEMBLE_OK,
     INTERPRET_REPL_EXIT,
     INTERPRET_ERROR_CAUGHT,
+    INTERPRET_ARM_WAIT_POINT, // run_frame_until()暂停执行，由invoke_and_wait()设置跳转点后继续
 } InterpretResult;
 
 extern VM vm;
@@ -76,5 +77,9 @@ Class *value_class(Value value);
 void stack_push(Value value);
 Value stack_pop();
 void map_delete();
+void map_reserve(Map *map, int count);
+MapEntry *map_lookup(Map *map);
+MapEntry *map_find_native(Map *map, Value key);
+void map_add_native(Map *map, Value key, Value value);
 
 #endif //CLOX_VM_H